@@ -0,0 +1,318 @@
+// MIT License
+//
+// MEL - Mechatronics Engine & Library
+// Copyright (c) 2019 Mechatronics and Haptic Interfaces Lab - Rice University
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// Author(s): Evan Pezent (epezent@rice.edu)
+
+#include <MEL/Communications/MelShare.hpp>
+#include <MEL/Communications/Packet.hpp>
+#include <MEL/Core/Clock.hpp>
+#include <MEL/Core/Console.hpp>
+#include <MEL/Core/LatencyHistogram.hpp>
+#include <MEL/Core/Timer.hpp>
+#include <MEL/Daq/VirtualDaq.hpp>
+#include <MEL/Math/Butterworth.hpp>
+#include <MEL/Math/Trajectory.hpp>
+#include <MEL/Mechatronics/Motor.hpp>
+#include <MEL/Mechatronics/PidBank.hpp>
+#include <MEL/Mechatronics/PidController.hpp>
+#include <MEL/Mechatronics/Robot.hpp>
+#include <MEL/Mechatronics/RobotModel.hpp>
+#include <MEL/Logging/Log.hpp>
+#include <MEL/Utility/Options.hpp>
+#include <MEL/Utility/System.hpp>
+#include <fstream>
+#include <functional>
+#include <string>
+#include <vector>
+
+using namespace mel;
+
+// Benchmark result. Statistics are per call, in nanoseconds.
+struct Result {
+    std::string name;
+    int64 samples;
+    double min, mean, p50, p99, max;
+};
+
+// Times batches of calls to func and returns per-call statistics
+Result bench(const std::string& name, int64 batches, int64 batch_size, std::function<void()> func) {
+    LatencyHistogram hist;
+    Clock clock;
+    for (int64 i = 0; i < batch_size; ++i) // warm up
+        func();
+    for (int64 b = 0; b < batches; ++b) {
+        Time start = clock.get_elapsed_time();
+        for (int64 i = 0; i < batch_size; ++i)
+            func();
+        hist.record(clock.get_elapsed_time() - start);
+    }
+    double n = static_cast<double>(batch_size);
+    return { name, batches * batch_size,
+             hist.get_min().as_nanoseconds() / n,
+             hist.get_mean().as_nanoseconds() / n,
+             hist.get_percentile(50.0).as_nanoseconds() / n,
+             hist.get_percentile(99.0).as_nanoseconds() / n,
+             hist.get_max().as_nanoseconds() / n };
+}
+
+// Converts Timer lateness into a Result
+Result bench_timer(const std::string& name, Frequency frequency, Timer::WaitMode mode, int64 ticks) {
+    Timer timer(frequency, mode, false);
+    timer.enable_histograms();
+    for (int64 i = 0; i < ticks; ++i)
+        timer.wait();
+    const LatencyHistogram& hist = timer.get_lateness_histogram();
+    return { name, hist.get_count(),
+             static_cast<double>(hist.get_min().as_nanoseconds()),
+             static_cast<double>(hist.get_mean().as_nanoseconds()),
+             static_cast<double>(hist.get_percentile(50.0).as_nanoseconds()),
+             static_cast<double>(hist.get_percentile(99.0).as_nanoseconds()),
+             static_cast<double>(hist.get_max().as_nanoseconds()) };
+}
+
+void write_json(const std::string& filepath, const std::vector<Result>& results) {
+    std::ofstream file(filepath);
+    file << "{\n  \"unit\": \"ns\",\n  \"results\": [\n";
+    for (std::size_t i = 0; i < results.size(); ++i) {
+        const Result& r = results[i];
+        file << "    {\"name\": \"" << r.name << "\", \"samples\": " << r.samples
+             << ", \"min\": " << r.min << ", \"mean\": " << r.mean
+             << ", \"p50\": " << r.p50 << ", \"p99\": " << r.p99
+             << ", \"max\": " << r.max << "}" << (i + 1 < results.size() ? ",\n" : "\n");
+    }
+    file << "  ]\n}\n";
+}
+
+void write_csv(const std::string& filepath, const std::vector<Result>& results) {
+    std::ofstream file(filepath);
+    file << "name,samples,min_ns,mean_ns,p50_ns,p99_ns,max_ns\n";
+    for (auto& r : results)
+        file << r.name << "," << r.samples << "," << r.min << "," << r.mean << ","
+             << r.p50 << "," << r.p99 << "," << r.max << "\n";
+}
+
+int main(int argc, char* argv[]) {
+
+    Options options("mel_bench", "MEL performance benchmarks");
+    options.add_options()
+        ("j,json", "Writes results to a JSON file", value<std::string>())
+        ("c,csv", "Writes results to a CSV file", value<std::string>())
+        ("f,filter", "Runs only benchmarks whose name contains this string", value<std::string>())
+        ("q,quick", "Runs 10x fewer iterations")
+        ("h,help", "Prints this help message");
+    auto result = options.parse(argc, argv);
+    if (result.count("help") > 0) {
+        print(options.help());
+        return 0;
+    }
+
+    MEL_LOG->set_max_severity(Warning);
+
+    const int64 batches = result.count("quick") > 0 ? 1000 : 10000;
+    const std::string filter = result.count("filter") > 0 ? result["filter"].as<std::string>() : "";
+    std::vector<Result> results;
+    auto run = [&](const std::string& name, std::function<Result()> bench_func) {
+        if (filter.empty() || name.find(filter) != std::string::npos)
+            results.push_back(bench_func());
+    };
+
+    // DAQ
+    VirtualDaq daq("mel_bench");
+    daq.open();
+    daq.enable();
+    volatile double sink = 0.0;
+    run("daq.virtual.update_input", [&]() {
+        return bench("daq.virtual.update_input", batches, 10, [&]() { daq.update_input(); });
+    });
+    run("daq.virtual.update_output", [&]() {
+        return bench("daq.virtual.update_output", batches, 10, [&]() { daq.update_output(); });
+    });
+    run("daq.virtual.round_trip", [&]() {
+        return bench("daq.virtual.round_trip", batches, 10, [&]() {
+            daq.update_input();
+            daq.AO.set_value(0, daq.AI.get_value(0));
+            daq.update_output();
+        });
+    });
+    run("daq.registry.get_value", [&]() {
+        ChanNum ch = 0;
+        return bench("daq.registry.get_value", batches, 100, [&]() {
+            sink = daq.AI.get_value(ch);
+            ch = ch == 8 ? 0 : ch + 1;
+        });
+    });
+    run("daq.channel.get_value", [&]() {
+        auto channels = daq.AI.get_channels(daq.AI.get_channel_numbers());
+        std::size_t i = 0;
+        return bench("daq.channel.get_value", batches, 100, [&]() {
+            sink = channels[i].get_value();
+            i = i == 8 ? 0 : i + 1;
+        });
+    });
+    run("daq.encoder.get_positions", [&]() {
+        return bench("daq.encoder.get_positions", batches, 100, [&]() {
+            sink = daq.encoder.get_positions()[0];
+        });
+    });
+
+    // Mechatronics (7-DOF robot on the virtual DAQ)
+    std::vector<Motor> motors;
+    std::vector<Encoder::Channel> positions;
+    std::vector<Encoder::VelocityChannel> velocities;
+    motors.reserve(7);
+    positions.reserve(7);
+    velocities.reserve(7);
+    Robot robot("mel_bench");
+    for (ChanNum i = 0; i < 7; ++i) {
+        motors.emplace_back("motor" + stringify(i), 0.1, Amplifier("amp" + stringify(i), High, daq.DO[i], 1.0, daq.AO[i]));
+        positions.push_back(daq.encoder[i]);
+        velocities.push_back(daq.encoder.get_velocity_channel(i));
+        robot.add_joint(Joint("joint" + stringify(i), &motors[i], &positions[i], &velocities[i], 10.0));
+    }
+    std::vector<double> torques(7, 0.01);
+    run("robot.7dof.per_joint_read", [&]() {
+        return bench("robot.7dof.per_joint_read", batches, 10, [&]() {
+            std::vector<double> p, v;
+            for (uint32 i = 0; i < 7; ++i) {
+                p.push_back(robot[i].get_position());
+                v.push_back(robot[i].get_velocity());
+            }
+            sink = p[0] + v[0];
+        });
+    });
+    run("robot.7dof.update", [&]() {
+        return bench("robot.7dof.update", batches, 10, [&]() {
+            robot.update();
+            sink = robot.get_last_joint_positions()[0] + robot.get_last_joint_velocities()[0];
+        });
+    });
+    run("robot.7dof.set_joint_torques", [&]() {
+        return bench("robot.7dof.set_joint_torques", batches, 10, [&]() {
+            robot.set_joint_torques(torques);
+        });
+    });
+    run("robot.7dof.set_joint_torques.saturating", [&]() {
+        Robot limited("mel_bench_limited");
+        for (ChanNum i = 0; i < 7; ++i)
+            limited.add_joint(Joint("limited" + stringify(i), &motors[i], &positions[i], &velocities[i], 10.0,
+                                    { -INF, INF }, INF, 0.001));
+        return bench("robot.7dof.set_joint_torques.saturating", batches, 10, [&]() {
+            limited.set_joint_torques(torques);
+        });
+    });
+
+    run("robot.model.7dof.inverse_dynamics", [&]() {
+        RobotModel model;
+        for (int i = 0; i < 7; ++i) {
+            RobotModel::Link link = { RobotModel::Revolute, 0.0, i % 2 == 0 ? PI / 2 : -PI / 2, 0.3, 0.0, 2.0,
+                                      { { 0.0, -0.02, 0.05 } }, { { 0.02, 0.02, 0.01, 0.0, 0.0, 0.0 } } };
+            model.add_link(link);
+        }
+        std::vector<double> q(7, 0.3), qd(7, 0.5), qdd(7, 1.0);
+        return bench("robot.model.7dof.inverse_dynamics", batches, 10, [&]() {
+            q[0] += 1e-6;
+            sink = model.inverse_dynamics(q, qd, qdd)[0];
+        });
+    });
+
+    // Control (16 axes, one tick per call)
+    run("control.pid.scalar.x16", [&]() {
+        std::vector<PidController> pids(16, PidController(100.0, 10.0, 2.0));
+        std::vector<double> ref(16, 1.0), x(16, 0.0), u(16, 0.0);
+        Time t = Time::Zero;
+        return bench("control.pid.scalar.x16", batches, 10, [&]() {
+            t += milliseconds(1);
+            for (std::size_t i = 0; i < 16; ++i)
+                u[i] = pids[i].calculate(ref[i], x[i], t);
+            sink = u[0];
+        });
+    });
+    run("control.pid.bank.x16", [&]() {
+        PidBank pid(16, 100.0, 10.0, 2.0);
+        pid.set_derivative_cutoff(hertz(100));
+        std::vector<double> ref(16, 1.0), x(16, 0.0);
+        Time t = Time::Zero;
+        return bench("control.pid.bank.x16", batches, 10, [&]() {
+            t += milliseconds(1);
+            sink = pid.calculate(ref, x, t)[0];
+        });
+    });
+
+    // Math
+    run("math.butterworth4.update", [&]() {
+        Butterworth filter(4, 0.1);
+        double x = 0.0;
+        return bench("math.butterworth4.update", batches, 100, [&]() {
+            sink = filter.update(x);
+            x += 0.001;
+        });
+    });
+
+    run("math.trajectory.7dof.update", [&]() {
+        Trajectory traj(7, 4);
+        traj.reset(std::vector<double>(7, 0.0));
+        traj.add_minimum_jerk(std::vector<double>(7, 1.0), seconds(1e6));
+        Time t = Time::Zero;
+        return bench("math.trajectory.7dof.update", batches, 10, [&]() {
+            sink = traj.update(t)[0];
+            t += microseconds(100);
+        });
+    });
+
+    // Communications
+    run("comms.packet.serialize_16", [&]() {
+        Packet packet;
+        std::vector<double> data(16, 1.0);
+        return bench("comms.packet.serialize_16", batches, 10, [&]() {
+            packet.clear();
+            for (auto& d : data)
+                packet << d;
+            for (auto& d : data)
+                packet >> d;
+        });
+    });
+    run("comms.melshare.write_read_16", [&]() {
+        MelShare share("mel_bench");
+        std::vector<double> data(16, 1.0);
+        return bench("comms.melshare.write_read_16", batches, 10, [&]() {
+            share.write_data(data);
+            sink = share.read_data()[0];
+        });
+    });
+
+    // Timing
+    const int64 ticks = result.count("quick") > 0 ? 200 : 2000;
+    run("timer.lateness.1khz.sleep", [&]() {
+        return bench_timer("timer.lateness.1khz.sleep", hertz(1000), Timer::Sleep, ticks);
+    });
+    run("timer.lateness.1khz.hybrid", [&]() {
+        return bench_timer("timer.lateness.1khz.hybrid", hertz(1000), Timer::Hybrid, ticks);
+    });
+    run("timer.lateness.1khz.absolute", [&]() {
+        return bench_timer("timer.lateness.1khz.absolute", hertz(1000), Timer::Absolute, ticks);
+    });
+
+    daq.disable();
+    daq.close();
+
+    for (auto& r : results)
+        print(r.name + std::string(r.name.size() < 32 ? 32 - r.name.size() : 1, ' ') +
+              "mean " + stringify(r.mean) + " ns, p99 " + stringify(r.p99) + " ns, max " + stringify(r.max) + " ns");
+    if (result.count("json") > 0)
+        write_json(result["json"].as<std::string>(), results);
+    if (result.count("csv") > 0)
+        write_csv(result["csv"].as<std::string>(), results);
+    return 0;
+}
@@ -58,7 +58,9 @@ list(APPEND MEL_CORE_HEADERS
     "${MEL_CORE_HEADERS_DIR}/Console.hpp"
     "${MEL_CORE_HEADERS_DIR}/Device.hpp"
     "${MEL_CORE_HEADERS_DIR}/Frequency.hpp"
+    "${MEL_CORE_HEADERS_DIR}/LatencyHistogram.hpp"
     "${MEL_CORE_HEADERS_DIR}/NonCopyable.hpp"
+    "${MEL_CORE_HEADERS_DIR}/Scheduler.hpp"
     "${MEL_CORE_HEADERS_DIR}/Time.hpp"
     "${MEL_CORE_HEADERS_DIR}/Timer.hpp"
     "${MEL_CORE_HEADERS_DIR}/Timestamp.hpp"
@@ -68,6 +70,8 @@ list(APPEND MEL_CORE_HEADERS
 # MEL DAQ
 set(MEL_DAQ_HEADERS_DIR "${MEL_HEADERS_DIR}/Daq")
 list(APPEND MEL_DAQ_HEADERS
+    "${MEL_DAQ_HEADERS_DIR}/AsyncDaq.hpp"
+    "${MEL_DAQ_HEADERS_DIR}/ChanMap.hpp"
     "${MEL_DAQ_HEADERS_DIR}/ChannelBase.hpp"
     "${MEL_DAQ_HEADERS_DIR}/DaqBase.hpp"
     "${MEL_DAQ_HEADERS_DIR}/Encoder.hpp"
@@ -75,8 +79,14 @@ list(APPEND MEL_DAQ_HEADERS
     "${MEL_DAQ_HEADERS_DIR}/InputOutput.hpp"
     "${MEL_DAQ_HEADERS_DIR}/Module.hpp"
     "${MEL_DAQ_HEADERS_DIR}/Output.hpp"
+    "${MEL_DAQ_HEADERS_DIR}/RecordingDaq.hpp"
     "${MEL_DAQ_HEADERS_DIR}/Registry.hpp"
+    "${MEL_DAQ_HEADERS_DIR}/ReplayDaq.hpp"
+    "${MEL_DAQ_HEADERS_DIR}/ShmDaq.hpp"
+    "${MEL_DAQ_HEADERS_DIR}/SoftwareWatchdog.hpp"
+    "${MEL_DAQ_HEADERS_DIR}/StaticModule.hpp"
     "${MEL_DAQ_HEADERS_DIR}/VirtualDaq.hpp"
+    "${MEL_DAQ_HEADERS_DIR}/VirtualPlant.hpp"
     "${MEL_DAQ_HEADERS_DIR}/Watchdog.hpp"
     "${MEL_DAQ_HEADERS_DIR}/Detail/ChannelBase.inl"
     "${MEL_DAQ_HEADERS_DIR}/Detail/Input.inl"
@@ -84,6 +94,7 @@ list(APPEND MEL_DAQ_HEADERS
     "${MEL_DAQ_HEADERS_DIR}/Detail/Module.inl"
     "${MEL_DAQ_HEADERS_DIR}/Detail/Output.inl"
     "${MEL_DAQ_HEADERS_DIR}/Detail/Registry.inl"
+    "${MEL_DAQ_HEADERS_DIR}/Detail/StaticModule.inl"
 )
 
 # MEL Devices
@@ -124,7 +135,9 @@ list(APPEND MEL_MATH_HEADERS
     "${MEL_MATH_HEADERS_DIR}/Integrator.hpp"
     "${MEL_MATH_HEADERS_DIR}/Random.hpp"
     "${MEL_MATH_HEADERS_DIR}/TimeFunction.hpp"
+    "${MEL_MATH_HEADERS_DIR}/Trajectory.hpp"
     "${MEL_MATH_HEADERS_DIR}/Waveform.hpp"
+    "${MEL_MATH_HEADERS_DIR}/WaveformBank.hpp"
 )
 
 # MEL Mechatronics
@@ -132,14 +145,17 @@ set(MEL_MECHATRONICS_HEADERS_DIR "${MEL_HEADERS_DIR}/Mechatronics")
 list(APPEND MEL_MECHATRONICS_HEADERS
     "${MEL_MECHATRONICS_HEADERS_DIR}/Actuator.hpp"
     "${MEL_MECHATRONICS_HEADERS_DIR}/Amplifier.hpp"
+    "${MEL_MECHATRONICS_HEADERS_DIR}/FaultChannel.hpp"
     "${MEL_MECHATRONICS_HEADERS_DIR}/ForceSensor.hpp"
     "${MEL_MECHATRONICS_HEADERS_DIR}/Joint.hpp"
     "${MEL_MECHATRONICS_HEADERS_DIR}/Limiter.hpp"
     "${MEL_MECHATRONICS_HEADERS_DIR}/Motor.hpp"
     "${MEL_MECHATRONICS_HEADERS_DIR}/PdController.hpp"
+    "${MEL_MECHATRONICS_HEADERS_DIR}/PidBank.hpp"
     "${MEL_MECHATRONICS_HEADERS_DIR}/PidController.hpp"
     "${MEL_MECHATRONICS_HEADERS_DIR}/PositionSensor.hpp"
     "${MEL_MECHATRONICS_HEADERS_DIR}/Robot.hpp"
+    "${MEL_MECHATRONICS_HEADERS_DIR}/RobotModel.hpp"
     "${MEL_MECHATRONICS_HEADERS_DIR}/TorqueSensor.hpp"
     "${MEL_MECHATRONICS_HEADERS_DIR}/VelocitySensor.hpp"
     "${MEL_MECHATRONICS_HEADERS_DIR}/VirtualVelocitySensor.hpp"
@@ -152,6 +168,7 @@ list(APPEND MEL_UTILITY_HEADERS
     "${MEL_UTILITY_HEADERS_DIR}/Mutex.hpp"
     "${MEL_UTILITY_HEADERS_DIR}/NamedMutex.hpp"
     "${MEL_UTILITY_HEADERS_DIR}/Options.hpp"
+    "${MEL_UTILITY_HEADERS_DIR}/RealtimeThread.hpp"
     "${MEL_UTILITY_HEADERS_DIR}/RingBuffer.hpp"
     "${MEL_UTILITY_HEADERS_DIR}/Singleton.hpp"
     "${MEL_UTILITY_HEADERS_DIR}/Spinlock.hpp"
@@ -159,6 +176,7 @@ list(APPEND MEL_UTILITY_HEADERS
     "${MEL_UTILITY_HEADERS_DIR}/StateMachine.hpp"
     "${MEL_UTILITY_HEADERS_DIR}/StlStreams.hpp"
     "${MEL_UTILITY_HEADERS_DIR}/System.hpp"
+    "${MEL_UTILITY_HEADERS_DIR}/TripleBuffer.hpp"
 )
 
 # collect common header files
@@ -273,6 +291,8 @@ list(APPEND MEL_CORE_SRC
     "${MEL_CORE_SRC_DIR}/Console.cpp"
     "${MEL_CORE_SRC_DIR}/Device.cpp"
     "${MEL_CORE_SRC_DIR}/Frequency.cpp"
+    "${MEL_CORE_SRC_DIR}/LatencyHistogram.cpp"
+    "${MEL_CORE_SRC_DIR}/Scheduler.cpp"
     "${MEL_CORE_SRC_DIR}/Time.cpp"
     "${MEL_CORE_SRC_DIR}/Timer.cpp"
     "${MEL_CORE_SRC_DIR}/Timestamp.cpp"
@@ -282,12 +302,22 @@ list(APPEND MEL_CORE_SRC
 # MEL DAQ
 set(MEL_DAQ_SRC_DIR "${MEL_SRC_DIR}/Daq")
 list(APPEND MEL_DAQ_SRC
+    "${MEL_DAQ_SRC_DIR}/AsyncDaq.cpp"
+    "${MEL_DAQ_SRC_DIR}/ChanMap.cpp"
     "${MEL_DAQ_SRC_DIR}/DaqBase.cpp"
     "${MEL_DAQ_SRC_DIR}/Encoder.cpp"
     "${MEL_DAQ_SRC_DIR}/Module.cpp"
+    "${MEL_DAQ_SRC_DIR}/RecordingDaq.cpp"
     "${MEL_DAQ_SRC_DIR}/Registry.cpp"
+    "${MEL_DAQ_SRC_DIR}/ReplayDaq.cpp"
+    "${MEL_DAQ_SRC_DIR}/ShmDaq.cpp"
+    "${MEL_DAQ_SRC_DIR}/SoftwareWatchdog.cpp"
+    "${MEL_DAQ_SRC_DIR}/StaticModule.cpp"
     "${MEL_DAQ_SRC_DIR}/VirtualDaq.cpp"
+    "${MEL_DAQ_SRC_DIR}/VirtualPlant.cpp"
     "${MEL_DAQ_SRC_DIR}/Watchdog.cpp"
+    "${MEL_DAQ_SRC_DIR}/Detail/DaqRecord.hpp"
+    "${MEL_DAQ_SRC_DIR}/Detail/ShmDaqLayout.hpp"
 )
 
 # MEL Devices
@@ -319,7 +349,9 @@ list(APPEND MEL_MATH_SRC
     "${MEL_MATH_SRC_DIR}/Integrator.cpp"
     "${MEL_MATH_SRC_DIR}/Random.cpp"
     "${MEL_MATH_SRC_DIR}/TimeFunction.cpp"
+    "${MEL_MATH_SRC_DIR}/Trajectory.cpp"
     "${MEL_MATH_SRC_DIR}/Waveform.cpp"
+    "${MEL_MATH_SRC_DIR}/WaveformBank.cpp"
 )
 
 # MEL Mechatronics
@@ -327,14 +359,17 @@ set(MEL_MECHATRONICS_SRC_DIR "${MEL_SRC_DIR}/Mechatronics")
 list(APPEND MEL_MECHATRONICS_SRC
     "${MEL_MECHATRONICS_SRC_DIR}/Actuator.cpp"
     "${MEL_MECHATRONICS_SRC_DIR}/Amplifier.cpp"
+    "${MEL_MECHATRONICS_SRC_DIR}/FaultChannel.cpp"
     "${MEL_MECHATRONICS_SRC_DIR}/ForceSensor.cpp"
     "${MEL_MECHATRONICS_SRC_DIR}/Joint.cpp"
     "${MEL_MECHATRONICS_SRC_DIR}/Limiter.cpp"
     "${MEL_MECHATRONICS_SRC_DIR}/Motor.cpp"
     "${MEL_MECHATRONICS_SRC_DIR}/PdController.cpp"
+    "${MEL_MECHATRONICS_SRC_DIR}/PidBank.cpp"
     "${MEL_MECHATRONICS_SRC_DIR}/PidController.cpp"
     "${MEL_MECHATRONICS_SRC_DIR}/PositionSensor.cpp"
     "${MEL_MECHATRONICS_SRC_DIR}/Robot.cpp"
+    "${MEL_MECHATRONICS_SRC_DIR}/RobotModel.cpp"
     "${MEL_MECHATRONICS_SRC_DIR}/TorqueSensor.cpp"
     "${MEL_MECHATRONICS_SRC_DIR}/VelocitySensor.cpp"
     "${MEL_MECHATRONICS_SRC_DIR}/VirtualVelocitySensor.cpp"
@@ -346,6 +381,7 @@ list(APPEND MEL_UTILITY_SRC
     "${MEL_UTILITY_SRC_DIR}/Lock.cpp"
     "${MEL_UTILITY_SRC_DIR}/Mutex.cpp"
     "${MEL_UTILITY_SRC_DIR}/NamedMutex.cpp"
+    "${MEL_UTILITY_SRC_DIR}/RealtimeThread.cpp"
     "${MEL_UTILITY_SRC_DIR}/Spinlock.cpp"
     "${MEL_UTILITY_SRC_DIR}/StateMachine.cpp"
     "${MEL_UTILITY_SRC_DIR}/System.cpp"
@@ -0,0 +1,111 @@
+// MIT License
+//
+// MEL - Mechatronics Engine & Library
+// Copyright (c) 2019 Mechatronics and Haptic Interfaces Lab - Rice University
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// Author(s): Evan Pezent (epezent@rice.edu)
+
+#include <MEL/Daq/AsyncDaq.hpp>
+#include <MEL/Daq/VirtualDaq.hpp>
+#include <MEL/Core/Timer.hpp>
+#include <MEL/Logging/Log.hpp>
+#include <MEL/Utility/System.hpp>
+
+using namespace mel;
+
+// VirtualDaq that blocks like a USB DAQ for a fixed time on every transaction
+class LatencyDaq : public VirtualDaq {
+public:
+    LatencyDaq(const std::string& name, Time latency) :
+        VirtualDaq(name), latency_(latency) { }
+
+    bool update_input() override {
+        block();
+        return VirtualDaq::update_input();
+    }
+
+    bool update_output() override {
+        block();
+        return VirtualDaq::update_output();
+    }
+
+private:
+    void block() {
+        Clock clock;
+        while (clock.get_elapsed_time() < latency_) { }
+    }
+
+    Time latency_;
+};
+
+// Runs a 1 kHz loop on daq and returns the mean time blocked in I/O per cycle
+template <typename Daq>
+Time run_loop(Daq& daq, int cycles, Time& max_blocked) {
+    Timer timer(hertz(1000), Timer::Absolute);
+    Clock clock;
+    Time total = Time::Zero;
+    max_blocked = Time::Zero;
+    for (int i = 0; i < cycles; ++i) {
+        clock.restart();
+        daq.update_input();
+        daq.AO.set_value(0, daq.encoder.get_value(0) * 0.001);
+        daq.update_output();
+        Time blocked = clock.get_elapsed_time();
+        total += blocked;
+        if (blocked > max_blocked)
+            max_blocked = blocked;
+        timer.wait();
+    }
+    return total / static_cast<int64>(cycles);
+}
+
+int main() {
+
+    MEL_LOG->set_max_severity(Info);
+
+    const int cycles = 2000;
+    const Time latency = microseconds(300);
+
+    // synchronous: every update blocks for the injected latency
+    LatencyDaq sync_daq("sync", latency);
+    sync_daq.open();
+    sync_daq.enable();
+    Time sync_max;
+    Time sync_mean = run_loop(sync_daq, cycles, sync_max);
+    sync_daq.disable();
+    sync_daq.close();
+
+    // asynchronous: the same DAQ behind an I/O thread
+    LatencyDaq slow_daq("slow", latency);
+    AsyncDaq async_daq("async", slow_daq, &slow_daq.AI, &slow_daq.DI, &slow_daq.encoder,
+                       &slow_daq.AO, &slow_daq.DO, hertz(1000));
+    async_daq.open();
+    async_daq.enable();
+    sleep(milliseconds(10)); // let the first snapshots arrive
+    Time async_max;
+    Time async_mean = run_loop(async_daq, cycles, async_max);
+    AsyncDaq::Stats stats = async_daq.get_stats();
+    async_daq.disable();
+    async_daq.close();
+
+    LOG(Info) << "Injected latency:         " << latency << " per transaction";
+    LOG(Info) << "Sync blocked (mean/max):  " << sync_mean << " / " << sync_max;
+    LOG(Info) << "Async blocked (mean/max): " << async_mean << " / " << async_max;
+    LOG(Info) << "I/O cycles:               " << stats.io_cycles;
+    LOG(Info) << "Stale inputs:             " << stats.stale_inputs;
+    LOG(Info) << "Dropped inputs:           " << stats.dropped_inputs;
+    LOG(Info) << "Dropped outputs:          " << stats.dropped_outputs;
+    LOG(Info) << "Max input age:            " << stats.max_input_age;
+
+    return 0;
+}
@@ -0,0 +1,86 @@
+// MIT License
+//
+// MEL - Mechatronics Engine & Library
+// Copyright (c) 2019 Mechatronics and Haptic Interfaces Lab - Rice University
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// Author(s): Evan Pezent (epezent@rice.edu)
+
+#include <MEL/Core/Clock.hpp>
+#include <MEL/Logging/Log.hpp>
+#include <MEL/Utility/Options.hpp>
+#include <MEL/Utility/System.hpp>
+#include <chrono>
+
+using namespace mel;
+
+// Measures the average cost of one Clock::get_elapsed_time() call
+double call_cost_ns(int64 calls) {
+    Clock clock;
+    Time sink = Time::Zero;
+    auto t0 = std::chrono::steady_clock::now();
+    for (int64 i = 0; i < calls; ++i)
+        sink += clock.get_elapsed_time();
+    auto t1 = std::chrono::steady_clock::now();
+    if (sink == Time::Zero)
+        LOG(Info) << "";  // keeps the loop from being optimized away
+    return std::chrono::duration<double, std::nano>(t1 - t0).count() / calls;
+}
+
+// Measures how far a Clock drifts from std::chrono::steady_clock
+double drift_ppm(Time duration) {
+    Clock clock;
+    auto t0 = std::chrono::steady_clock::now();
+    sleep(duration);
+    Time elapsed = clock.get_elapsed_time();
+    auto t1 = std::chrono::steady_clock::now();
+    double reference = std::chrono::duration<double, std::nano>(t1 - t0).count();
+    return (elapsed.as_nanoseconds() - reference) / reference * 1e6;
+}
+
+int main(int argc, char* argv[]) {
+
+    MEL_LOG->set_max_severity(Info);
+
+    Options options("clock_performance.exe", "Compares the cost and drift of Clock sources");
+    options.add_options()
+        ("n", "Number of clock reads per cost test (default 10000000)", value<int64>())
+        ("d", "Drift test duration in seconds (default 10)", value<double>())
+        ("h,help", "Prints this help message");
+
+    auto result = options.parse(argc, argv);
+    if (result.count("help") > 0) {
+        print(options.help());
+        return 0;
+    }
+
+    int64  n = result.count("n") > 0 ? result["n"].as<int64>() : 10000000;
+    double d = result.count("d") > 0 ? result["d"].as<double>() : 10.0;
+
+    LOG(Info) << "---OS Clock---";
+    Clock::set_source(Clock::Os);
+    LOG(Info) << "Cost per call:    " << call_cost_ns(n) << " ns";
+    LOG(Info) << "Drift:            " << drift_ppm(seconds(d)) << " ppm";
+
+    if (!Clock::is_tsc_available()) {
+        LOG(Warning) << "Invariant TSC not available on this CPU";
+        return 0;
+    }
+
+    LOG(Info) << "---TSC Clock---";
+    Clock::set_source(Clock::Tsc);
+    LOG(Info) << "Cost per call:    " << call_cost_ns(n) << " ns";
+    LOG(Info) << "Drift:            " << drift_ppm(seconds(d)) << " ppm";
+    Clock::set_source(Clock::Os);
+
+    return 0;
+}
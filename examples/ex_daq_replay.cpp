@@ -0,0 +1,78 @@
+// MIT License
+//
+// MEL - Mechatronics Engine & Library
+// Copyright (c) 2019 Mechatronics and Haptic Interfaces Lab - Rice University
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// Author(s): Evan Pezent (epezent@rice.edu)
+
+#include <MEL/Daq/VirtualDaq.hpp>
+#include <MEL/Daq/RecordingDaq.hpp>
+#include <MEL/Daq/ReplayDaq.hpp>
+#include <MEL/Core/Clock.hpp>
+#include <MEL/Logging/Log.hpp>
+
+using namespace mel;
+
+// Records a VirtualDaq session to disk, then replays it as fast as possible
+// and checks every replayed value against what was recorded.
+int main() {
+
+    MEL_LOG->set_max_severity(Info);
+
+    const std::size_t frames = 100000;
+    const std::string filepath = "ex_daq_replay.meldaq";
+
+    // record
+    VirtualDaq vdaq("virt");
+    RecordingDaq rec("rec", vdaq, filepath, &vdaq.AI, &vdaq.DI, &vdaq.encoder);
+    rec.open();
+    rec.enable();
+    std::vector<std::vector<double>> ai_log;
+    std::vector<std::vector<int32>> enc_log;
+    Clock clock;
+    Time t_plain = Time::Zero, t_rec = Time::Zero;
+    for (std::size_t i = 0; i < frames; ++i) {
+        clock.restart();
+        vdaq.update_input();
+        t_plain += clock.get_elapsed_time();
+        clock.restart();
+        rec.update_input();
+        t_rec += clock.get_elapsed_time();
+        ai_log.push_back(vdaq.AI.get_values());
+        enc_log.push_back(vdaq.encoder.get_values());
+    }
+    rec.close();
+
+    // replay
+    ReplayDaq replay("replay", filepath);
+    replay.open();
+    replay.enable();
+    std::size_t i = 0, mismatches = 0;
+    clock.restart();
+    while (replay.update_input()) {
+        if (replay.AI.get_values() != ai_log[i] || replay.encoder.get_values() != enc_log[i])
+            ++mismatches;
+        ++i;
+    }
+    Time t_replay = clock.get_elapsed_time();
+    replay.close();
+
+    LOG(Info) << "Frames recorded:        " << rec.get_frame_count();
+    LOG(Info) << "Frames replayed:        " << i;
+    LOG(Info) << "Mismatched frames:      " << mismatches;
+    LOG(Info) << "update_input (plain):   " << t_plain / static_cast<int64>(frames);
+    LOG(Info) << "update_input (record):  " << t_rec / static_cast<int64>(frames);
+    LOG(Info) << "update_input (replay):  " << t_replay / static_cast<int64>(i > 0 ? i : 1);
+
+    return mismatches == 0 && i == frames ? 0 : 1;
+}
@@ -0,0 +1,109 @@
+// MIT License
+//
+// MEL - Mechatronics Engine & Library
+// Copyright (c) 2019 Mechatronics and Haptic Interfaces Lab - Rice University
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// Author(s): Evan Pezent (epezent@rice.edu)
+
+#include <MEL/Daq/VirtualDaq.hpp>
+#include <MEL/Daq/VirtualPlant.hpp>
+#include <MEL/Math/Differentiator.hpp>
+#include <MEL/Math/Constants.hpp>
+#include <MEL/Core/Clock.hpp>
+#include <MEL/Logging/Log.hpp>
+#include <cmath>
+
+using namespace mel;
+
+// slow sinusoidal shaft motion measured by four identical encoder channels
+class ShaftPlant : public VirtualPlant {
+public:
+    ShaftPlant(double counts_per_rad) : counts_per_rad_(counts_per_rad), t_(0.0) { }
+
+    double position() const { return 0.05 * std::sin(2.0 * PI * 0.5 * t_); }
+    double velocity() const { return 0.05 * PI * std::cos(2.0 * PI * 0.5 * t_); }
+
+    void step(Time dt, const std::vector<Voltage>&, const std::vector<Logic>&) override {
+        t_ += dt.as_seconds();
+    }
+
+    void measure(std::vector<Voltage>&, std::vector<Logic>&, std::vector<int32>& encoder) override {
+        for (auto& counts : encoder)
+            counts = static_cast<int32>(std::floor(position() * counts_per_rad_));
+    }
+
+private:
+    double counts_per_rad_;
+    double t_;
+};
+
+// Compares the Encoder velocity estimators against a per-channel
+// Differentiator (as used by VirtualVelocitySensor) at low shaft speeds.
+int main() {
+
+    MEL_LOG->set_max_severity(Info);
+
+    const double cpr = 1024;
+    const double counts_per_rad = 4.0 * cpr / (2.0 * PI);
+    ShaftPlant plant(counts_per_rad);
+
+    VirtualDaq daq("sim");
+    daq.encoder.set_channel_numbers({0, 1, 2, 3});
+    daq.encoder.set_units_per_count(std::vector<double>(4, 2.0 * PI / cpr));
+    daq.encoder.set_velocity_estimator(0, Encoder::FixedTime, 0.0);
+    daq.encoder.set_velocity_estimator(1, Encoder::FixedTime, 0.01);
+    daq.encoder.set_velocity_estimator(2, Encoder::FixedPosition, 4);
+    daq.encoder.set_velocity_estimator(3, Encoder::TrackingLoop, 60.0);
+    daq.set_plant(&plant, milliseconds(1));
+    daq.open();
+    daq.enable();
+
+    const char* names[] = { "fixed-time (raw)", "fixed-time (10 ms lpf)", "fixed-position (4 counts)", "tracking loop (60 rad/s)" };
+    Differentiator diff;
+    double sq_err[4] = { 0, 0, 0, 0 };
+    double sq_err_diff = 0.0;
+    const int64 steps = 10000;  // 10 s simulated at 1 kHz
+    const int64 settle = 1000;
+    Time estimate_time;
+    for (int64 k = 0; k < steps; ++k) {
+        daq.update_input();
+        double truth = plant.velocity();
+        double d = diff.update(daq.encoder.get_position(0), daq.get_time());
+        if (k >= settle) {
+            for (int i = 0; i < 4; ++i) {
+                double e = daq.encoder.get_velocity_estimate(i) - truth;
+                sq_err[i] += e * e;
+            }
+            sq_err_diff += (d - truth) * (d - truth);
+        }
+        daq.update_output();
+    }
+
+    // cost of one batched estimation pass over all channels
+    const int64 reps = 1000000;
+    Clock clock;
+    for (int64 k = 0; k < reps; ++k)
+        daq.encoder.estimate_velocities(microseconds(k));
+    estimate_time = clock.get_elapsed_time();
+
+    const int64 n = steps - settle;
+    LOG(Info) << "Peak velocity:             " << 0.05 * PI << " rad/s (" << 0.05 * PI * counts_per_rad << " counts/s)";
+    LOG(Info) << "RMS error Differentiator:  " << std::sqrt(sq_err_diff / n) << " rad/s";
+    for (int i = 0; i < 4; ++i)
+        LOG(Info) << "RMS error " << names[i] << ": " << std::sqrt(sq_err[i] / n) << " rad/s";
+    LOG(Info) << "Batched estimate (4 ch):   " << estimate_time.as_microseconds() * 1000.0 / reps << " ns";
+
+    daq.disable();
+    daq.close();
+    return 0;
+}
@@ -0,0 +1,66 @@
+// MIT License
+//
+// MEL - Mechatronics Engine & Library
+// Copyright (c) 2019 Mechatronics and Haptic Interfaces Lab - Rice University
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// Author(s): Evan Pezent (epezent@rice.edu)
+
+#include <MEL/Utility/RealtimeThread.hpp>
+#include <MEL/Core/Timer.hpp>
+#include <MEL/Core/Console.hpp>
+#include <MEL/Utility/System.hpp>
+
+using namespace mel;
+
+ctrl_bool g_stop(false);
+
+bool my_handler(CtrlEvent event) {
+    if (event == CtrlEvent::CtrlC)
+        g_stop = true;
+    return true;
+}
+
+int main() {
+    register_ctrl_handler(my_handler);
+
+    // 1 kHz control loop at high priority on CPU 0, slow worker on CPU 1.
+    // Run with sudo (or CAP_SYS_NICE and CAP_IPC_LOCK) on Linux.
+    RealtimeThread control(90, {0});
+    RealtimeThread worker(10, {1});
+
+    control.start([]() {
+        Timer timer(hertz(1000), Timer::Absolute);
+        timer.enable_histograms();
+        while (!g_stop && timer.get_elapsed_time() < seconds(5))
+            timer.wait();
+        print(timer.get_histogram_table());
+    });
+
+    worker.start([]() {
+        while (!g_stop)
+            sleep(milliseconds(100));
+    });
+
+    control.join();
+    g_stop = true;
+    worker.join();
+
+    const RealtimeThread::Stats& stats = control.get_stats();
+    print("SCHED_FIFO:           ", stats.realtime);
+    print("Affinity:             ", stats.affinity);
+    print("Memory locked:        ", stats.memory_locked);
+    print("Minor page faults:    ", stats.minor_faults);
+    print("Major page faults:    ", stats.major_faults);
+    print("Involuntary switches: ", stats.involuntary_switches);
+    return 0;
+}
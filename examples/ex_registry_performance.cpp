@@ -0,0 +1,116 @@
+// MIT License
+//
+// MEL - Mechatronics Engine & Library
+// Copyright (c) 2019 Mechatronics and Haptic Interfaces Lab - Rice University
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// Author(s): Evan Pezent (epezent@rice.edu)
+
+#include <MEL/Daq/VirtualDaq.hpp>
+#include <MEL/Daq/StaticModule.hpp>
+#include <MEL/Logging/Log.hpp>
+#include <chrono>
+#include <map>
+
+using namespace mel;
+
+// Runs func n times and returns the average time per call in ns
+template <typename F>
+double bench(int64 n, F func) {
+    auto t0 = std::chrono::steady_clock::now();
+    for (int64 i = 0; i < n; ++i)
+        func(i);
+    auto t1 = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(t1 - t0).count() / n;
+}
+
+int main() {
+
+    MEL_LOG->set_max_severity(Info);
+
+    const int64 n = 10000000;
+    VirtualDaq daq("bench");
+    daq.open();
+    daq.enable();
+    daq.update_input();
+
+    ChanNums chs = daq.AI.get_channel_numbers();
+    std::size_t nch = chs.size();
+    volatile double sink = 0.0;
+
+    // reference: the std::map lookup Registry used to perform
+    std::map<ChanNum, std::size_t> ref_map;
+    for (std::size_t i = 0; i < nch; ++i)
+        ref_map[chs[i]] = i;
+    std::vector<double> ref_values(nch, 1.0);
+    double t_map = bench(n, [&](int64 i) {
+        sink = ref_values[ref_map.at(chs[i % nch])];
+    });
+
+    // dense ChanMap lookup used by every Registry
+    ChanMap dense(chs);
+    double t_dense = bench(n, [&](int64 i) {
+        sink = ref_values[dense.at(chs[i % nch])];
+    });
+
+    // sparse ChanMap lookup (binary search)
+    ChanNums sparse_chs;
+    for (std::size_t i = 0; i < nch; ++i)
+        sparse_chs.push_back(static_cast<ChanNum>(i * 1000));
+    ChanMap sparse(sparse_chs);
+    double t_sparse = bench(n, [&](int64 i) {
+        sink = ref_values[sparse.at(sparse_chs[i % nch])];
+    });
+
+    // full Module paths
+    double t_ai = bench(n, [&](int64 i) {
+        sink = daq.AI.get_value(chs[i % nch]);
+    });
+    double t_ao = bench(n, [&](int64 i) {
+        daq.AO.set_value(chs[i % nch], 1.0);
+    });
+    ChanNums enc_chs = daq.encoder.get_channel_numbers();
+    double t_enc = bench(n, [&](int64 i) {
+        sink = daq.encoder.get_position(enc_chs[i % enc_chs.size()]);
+    });
+
+    // Channel handles with cached indices
+    auto ai_chs  = daq.AI.get_channels(chs);
+    auto enc_hdl = daq.encoder.get_channels(enc_chs);
+    double t_ai_ch = bench(n, [&](int64 i) {
+        sink = ai_chs[i % nch].get_value();
+    });
+    double t_enc_ch = bench(n, [&](int64 i) {
+        sink = enc_hdl[i % enc_hdl.size()].get_position();
+    });
+
+    // compile-time channel indices
+    StaticModule<VirtualAI, 0, 1, 2, 3, 4, 5, 6, 7, 8> static_ai(daq, ChanNums());
+    static_ai.update();
+    double t_static = bench(n, [&](int64 i) {
+        sink = static_ai.get<3>() + static_ai.get<7>();
+    }) / 2.0;
+
+    LOG(Info) << "std::map lookup:         " << t_map    << " ns";
+    LOG(Info) << "ChanMap dense lookup:    " << t_dense  << " ns";
+    LOG(Info) << "ChanMap sparse lookup:   " << t_sparse << " ns";
+    LOG(Info) << "AI.get_value:            " << t_ai     << " ns";
+    LOG(Info) << "AO.set_value:            " << t_ao     << " ns";
+    LOG(Info) << "encoder.get_position:    " << t_enc    << " ns";
+    LOG(Info) << "AI::Channel::get_value:  " << t_ai_ch  << " ns";
+    LOG(Info) << "Encoder::Channel pos:    " << t_enc_ch << " ns";
+    LOG(Info) << "StaticModule::get<Ch>:   " << t_static << " ns";
+
+    daq.disable();
+    daq.close();
+    return 0;
+}
@@ -0,0 +1,225 @@
+// MIT License
+//
+// MEL - Mechatronics Engine & Library
+// Copyright (c) 2019 Mechatronics and Haptic Interfaces Lab - Rice University
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// Author(s): Evan Pezent (epezent@rice.edu)
+
+#include <MEL/Mechatronics/RobotModel.hpp>
+#include <MEL/Mechatronics/Robot.hpp>
+#include <MEL/Mechatronics/Motor.hpp>
+#include <MEL/Daq/VirtualDaq.hpp>
+#include <MEL/Core/Clock.hpp>
+#include <MEL/Core/LatencyHistogram.hpp>
+#include <MEL/Logging/Log.hpp>
+#include <MEL/Math/Constants.hpp>
+#include <MEL/Math/Random.hpp>
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <string>
+
+using namespace mel;
+
+// potential energy of the chain at q
+double potential(RobotModel& model, const std::vector<double>& q, double g) {
+    model.forward_kinematics(q);
+    double V = 0.0;
+    for (std::size_t i = 0; i < model.size(); ++i) {
+        auto p = model.get_frame_position(i);
+        auto R = model.get_frame_rotation(i);
+        auto& c = model.get_link(i).com;
+        double z = p[2] + R[6] * c[0] + R[7] * c[1] + R[8] * c[2];
+        V += model.get_link(i).mass * g * z;
+    }
+    return V;
+}
+
+// total energy 1/2 qd' M qd + V, with M built column by column from
+// inverse dynamics
+double energy(RobotModel& model, const std::vector<double>& q, const std::vector<double>& qd, double g) {
+    std::size_t n = model.size();
+    std::vector<double> zero(n, 0.0), e(n, 0.0);
+    std::vector<double> grav = model.gravity_torques(q);
+    double T = 0.0;
+    for (std::size_t j = 0; j < n; ++j) {
+        e[j] = 1.0;
+        const std::vector<double>& col = model.inverse_dynamics(q, zero, e);
+        for (std::size_t i = 0; i < n; ++i)
+            T += 0.5 * qd[i] * (col[i] - grav[i]) * qd[j];
+        e[j] = 0.0;
+    }
+    return T + potential(model, q, g);
+}
+
+// logs a cross-check result and returns true if error is within tolerance
+bool check(const std::string& name, double error, double tolerance) {
+    bool pass = std::abs(error) <= tolerance;
+    if (pass)
+        LOG(Info) << name << " max error " << error << " (tolerance " << tolerance << ")";
+    else
+        LOG(Error) << name << " max error " << error << " exceeds tolerance " << tolerance;
+    return pass;
+}
+
+// Cross-checks RobotModel against a closed-form planar two link arm and,
+// for a 7-DOF arm, against finite differences of potential energy (gravity),
+// tool position (Jacobian) and total energy (power balance of the full
+// inverse dynamics), then times each call. Returns nonzero if any check
+// exceeds its tolerance, so it also runs as a CTest.
+int main() {
+
+    MEL_LOG->set_max_severity(Info);
+
+    // planar two link arm loaded from file, moving in the x-y plane
+    double l1 = 0.3, lc1 = 0.15, lc2 = 0.12, m1 = 1.0, m2 = 0.8, I1 = 0.01, I2 = 0.008, g = 9.81;
+    {
+        std::ofstream file("two_link.csv");
+        file << "# type, a, alpha, d, theta, mass, cx, cy, cz, Ixx, Iyy, Izz, Ixy, Ixz, Iyz\n";
+        file << "0, 0.0, 0, 0, 0, " << m1 << ", " << lc1 << ", 0, 0, 0, 0, " << I1 << ", 0, 0, 0\n";
+        file << "0, " << l1 << ", 0, 0, 0, " << m2 << ", " << lc2 << ", 0, 0, 0, 0, " << I2 << ", 0, 0, 0\n";
+    }
+    RobotModel planar;
+    planar.load("two_link.csv");
+    planar.set_gravity({ { 0.0, -g, 0.0 } });
+    double planar_err = 0.0;
+    for (int trial = 0; trial < 100; ++trial) {
+        std::vector<double> q = { random(-PI, PI), random(-PI, PI) };
+        std::vector<double> qd = { random(-3.0, 3.0), random(-3.0, 3.0) };
+        std::vector<double> qdd = { random(-10.0, 10.0), random(-10.0, 10.0) };
+        double c2 = std::cos(q[1]), s2 = std::sin(q[1]);
+        double M11 = I1 + I2 + m1 * lc1 * lc1 + m2 * (l1 * l1 + lc2 * lc2 + 2 * l1 * lc2 * c2);
+        double M12 = I2 + m2 * (lc2 * lc2 + l1 * lc2 * c2);
+        double M22 = I2 + m2 * lc2 * lc2;
+        double h = m2 * l1 * lc2 * s2;
+        double g1 = (m1 * lc1 + m2 * l1) * g * std::cos(q[0]) + m2 * lc2 * g * std::cos(q[0] + q[1]);
+        double g2 = m2 * lc2 * g * std::cos(q[0] + q[1]);
+        double tau1 = M11 * qdd[0] + M12 * qdd[1] - h * (2 * qd[0] * qd[1] + qd[1] * qd[1]) + g1;
+        double tau2 = M12 * qdd[0] + M22 * qdd[1] + h * qd[0] * qd[0] + g2;
+        const std::vector<double>& tau = planar.inverse_dynamics(q, qd, qdd);
+        planar_err = std::max(planar_err, std::max(std::abs(tau[0] - tau1), std::abs(tau[1] - tau2)));
+    }
+
+    // 7-DOF arm (modified DH, alternating twists)
+    RobotModel arm;
+    double alphas[7] = { 0, -PI / 2, PI / 2, PI / 2, -PI / 2, -PI / 2, PI / 2 };
+    double ds[7] = { 0.34, 0, 0.4, 0, 0.4, 0, 0.126 };
+    double masses[7] = { 4.0, 4.0, 3.0, 2.7, 1.7, 1.8, 0.3 };
+    for (int i = 0; i < 7; ++i) {
+        RobotModel::Link link;
+        link.type = RobotModel::Revolute;
+        link.a = i == 3 ? 0.0825 : 0.0;
+        link.alpha = alphas[i];
+        link.d = ds[i];
+        link.theta = 0.0;
+        link.mass = masses[i];
+        link.com = { { 0.01 * i, -0.02, 0.05 } };
+        link.inertia = { { 0.02, 0.018, 0.01, 0.001, -0.002, 0.0005 } };
+        arm.add_link(link);
+    }
+    arm.set_tool({ { 0.0, 0.0, 0.1 } });
+
+    const double eps = 1e-6;
+    double gravity_err = 0.0, jacobian_err = 0.0, power_err = 0.0, power_scale = 0.0;
+    for (int trial = 0; trial < 20; ++trial) {
+        std::vector<double> q(7), qd(7), qdd(7);
+        for (int i = 0; i < 7; ++i) {
+            q[i] = random(-PI, PI);
+            qd[i] = random(-2.0, 2.0);
+            qdd[i] = random(-5.0, 5.0);
+        }
+        // gravity: tau_g = dV/dq
+        std::vector<double> tau_g = arm.gravity_torques(q);
+        std::vector<double> J = arm.jacobian(q);
+        auto tool = arm.get_tool_position();
+        for (int j = 0; j < 7; ++j) {
+            std::vector<double> qp = q, qm = q;
+            qp[j] += eps;
+            qm[j] -= eps;
+            double dV = (potential(arm, qp, g) - potential(arm, qm, g)) / (2 * eps);
+            gravity_err = std::max(gravity_err, std::abs(dV - tau_g[j]));
+            arm.forward_kinematics(qp);
+            auto tp = arm.get_tool_position();
+            for (int k = 0; k < 3; ++k)
+                jacobian_err = std::max(jacobian_err, std::abs((tp[k] - tool[k]) / eps - J[6 * j + k]));
+        }
+        // power balance: tau . qd = dE/dt along q + qd t + qdd t^2 / 2
+        std::vector<double> tau = arm.inverse_dynamics(q, qd, qdd);
+        double power = 0.0;
+        for (int i = 0; i < 7; ++i)
+            power += tau[i] * qd[i];
+        const double dt = 1e-5;
+        std::vector<double> qp(7), qm(7), qdp(7), qdm(7);
+        for (int i = 0; i < 7; ++i) {
+            qp[i] = q[i] + qd[i] * dt + 0.5 * qdd[i] * dt * dt;
+            qm[i] = q[i] - qd[i] * dt + 0.5 * qdd[i] * dt * dt;
+            qdp[i] = qd[i] + qdd[i] * dt;
+            qdm[i] = qd[i] - qdd[i] * dt;
+        }
+        double dE = (energy(arm, qp, qdp, g) - energy(arm, qm, qdm, g)) / (2 * dt);
+        power_err = std::max(power_err, std::abs(dE - power));
+        power_scale = std::max(power_scale, std::abs(power));
+    }
+
+    // timing for one control tick
+    LatencyHistogram fk_cost, jac_cost, id_cost;
+    std::vector<double> q(7, 0.3), qd(7, 0.5), qdd(7, 1.0);
+    Clock clock;
+    for (int i = 0; i < 10000; ++i) {
+        q[i % 7] += 1e-4;
+        Time start = clock.get_elapsed_time();
+        arm.forward_kinematics(q);
+        fk_cost.record(clock.get_elapsed_time() - start);
+        start = clock.get_elapsed_time();
+        arm.jacobian(q);
+        jac_cost.record(clock.get_elapsed_time() - start);
+        start = clock.get_elapsed_time();
+        arm.inverse_dynamics(q, qd, qdd);
+        id_cost.record(clock.get_elapsed_time() - start);
+    }
+
+    // the same planar model attached to a Robot driven by a VirtualDaq
+    VirtualDaq daq("dynamics");
+    daq.open();
+    daq.enable();
+    Motor motor0("motor0", 0.1, Amplifier("amp0", High, daq.DO[0], 1.0, daq.AO[0]));
+    Motor motor1("motor1", 0.1, Amplifier("amp1", High, daq.DO[1], 1.0, daq.AO[1]));
+    Encoder::Channel p0 = daq.encoder[0], p1 = daq.encoder[1];
+    Encoder::VelocityChannel v0 = daq.encoder.get_velocity_channel(0);
+    Encoder::VelocityChannel v1 = daq.encoder.get_velocity_channel(1);
+    Robot robot("two_link");
+    robot.add_joint(Joint("shoulder", &motor0, &p0, &v0, 1.0));
+    robot.add_joint(Joint("elbow", &motor1, &p1, &v1, 1.0));
+    robot.load_model("two_link.csv");
+    robot.get_model().set_gravity({ { 0.0, -g, 0.0 } });
+    daq.update_input();
+    robot.update();
+    const std::vector<double>& hold = robot.get_gravity_torques();
+    const std::vector<double>& angles = robot.get_last_joint_positions();
+    double expected = (m1 * lc1 + m2 * l1) * g * std::cos(angles[0]) + m2 * lc2 * g * std::cos(angles[0] + angles[1]);
+    daq.disable();
+    daq.close();
+
+    // tolerances sit well above the finite difference truncation error
+    // (O(eps) for the one-sided Jacobian difference, O(eps^2) otherwise)
+    bool pass = true;
+    pass &= check("Planar 2R vs closed form [Nm]: ", planar_err, 1e-9);
+    pass &= check("7-DOF gravity vs dV/dq [Nm]:   ", gravity_err, 1e-5);
+    pass &= check("7-DOF Jacobian vs FK diff:     ", jacobian_err, 1e-4);
+    pass &= check("7-DOF power vs dE/dt [W]:      ", power_err, 1e-6 * std::max(1.0, power_scale));
+    pass &= check("Robot shoulder gravity [Nm]:   ", hold[0] - expected, 1e-9);
+    LOG(Info) << "7-DOF forward kinematics:      mean " << fk_cost.get_mean() << ", p99 " << fk_cost.get_percentile(99);
+    LOG(Info) << "7-DOF Jacobian:                mean " << jac_cost.get_mean() << ", p99 " << jac_cost.get_percentile(99);
+    LOG(Info) << "7-DOF inverse dynamics:        mean " << id_cost.get_mean() << ", p99 " << id_cost.get_percentile(99);
+    return pass ? 0 : 1;
+}
@@ -0,0 +1,62 @@
+// MIT License
+//
+// MEL - Mechatronics Engine & Library
+// Copyright (c) 2019 Mechatronics and Haptic Interfaces Lab - Rice University
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// Author(s): Evan Pezent (epezent@rice.edu)
+
+#include <MEL/Core/Scheduler.hpp>
+#include <MEL/Core/Console.hpp>
+#include <MEL/Logging/Csv.hpp>
+#include <MEL/Math/Waveform.hpp>
+
+using namespace mel;
+
+Scheduler* g_sched = nullptr;
+
+bool my_handler(CtrlEvent event) {
+    if (event == CtrlEvent::CtrlC && g_sched)
+        g_sched->stop();
+    return true;
+}
+
+int main() {
+    register_ctrl_handler(my_handler);
+
+    Scheduler sched(hertz(1000));
+    g_sched = &sched;
+
+    Waveform wave(Waveform::Sin, seconds(1));
+    double x = 0.0;
+    Csv csv("scheduler_log.csv");
+
+    // 1000 Hz control task, registered first so it always runs first
+    sched.add_task("control", [&]() {
+        x = wave(sched.get_timer().get_elapsed_time());
+    });
+
+    // 100 Hz logging task, offset to base ticks 5, 15, 25, ...
+    sched.add_task("log", [&]() {
+        csv.write_row(sched.get_timer().get_elapsed_time().as_seconds(), x);
+    }, 10, 5);
+
+    // 10 Hz console task with a 500 us budget
+    sched.add_task("print", [&]() {
+        print(x);
+    }, 100, 0, microseconds(500));
+
+    print("Running for 5 seconds. Press Ctrl+C to stop early.");
+    sched.run(seconds(5));
+    print(sched.get_task_table());
+    return 0;
+}
@@ -0,0 +1,130 @@
+// MIT License
+//
+// MEL - Mechatronics Engine & Library
+// Copyright (c) 2019 Mechatronics and Haptic Interfaces Lab - Rice University
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// Author(s): Evan Pezent (epezent@rice.edu)
+
+#include <MEL/Daq/ShmDaq.hpp>
+#include <MEL/Daq/VirtualDaq.hpp>
+#include <MEL/Core/Clock.hpp>
+#include <MEL/Core/Timer.hpp>
+#include <MEL/Logging/Log.hpp>
+#include <MEL/Utility/System.hpp>
+#include <atomic>
+#include <thread>
+
+using namespace mel;
+
+// Serves a VirtualDaq through shared memory. Run "shm_daq server" in one
+// terminal and "shm_daq client" in others, or with no arguments to run both
+// in one process and measure the overhead of the bridge.
+
+void serve(std::atomic<bool>& running, Time duration) {
+    VirtualDaq daq("hardware");
+    ShmDaqServer server("server", daq, "mel_shm_daq", &daq.AI, &daq.DI, &daq.encoder, &daq.AO, &daq.DO);
+    server.open();
+    server.enable();
+    Timer timer(hertz(1000), Timer::Hybrid);
+    Clock clock;
+    while (running && clock.get_elapsed_time() < duration) {
+        server.update_input();
+        server.update_output();
+        timer.wait();
+    }
+    LOG(Info) << "Server applied " << server.get_output_commands() << " client commands";
+    server.disable();
+    server.close();
+}
+
+void consume(Time duration) {
+    ShmDaq daq("client", "mel_shm_daq");
+    if (!daq.open())
+        return;
+    daq.enable();
+    daq.AO.enable();
+    Timer timer(hertz(1000), Timer::Hybrid);
+    Clock clock;
+    while (clock.get_elapsed_time() < duration) {
+        daq.update_input();
+        daq.AO.set_value(0, daq.AI.get_value(0));
+        daq.update_output();
+        timer.wait();
+    }
+    LOG(Info) << "Client read inputs published at " << daq.get_input_timestamp() << " (" << daq.get_stale_inputs() << " stale reads)";
+    daq.disable();
+    daq.close();
+}
+
+int main(int argc, char* argv[]) {
+
+    MEL_LOG->set_max_severity(Info);
+
+    std::atomic<bool> running(true);
+    if (argc > 1 && std::string(argv[1]) == "server") {
+        serve(running, seconds(60));
+        return 0;
+    }
+    if (argc > 1 && std::string(argv[1]) == "client") {
+        consume(seconds(10));
+        return 0;
+    }
+
+    // cost of the bridge per update, measured in one process
+    VirtualDaq hw("hardware");
+    ShmDaqServer server("server", hw, "mel_shm_bench", &hw.AI, &hw.DI, &hw.encoder, &hw.AO, &hw.DO);
+    server.open();
+    server.enable();
+    ShmDaq client("client", "mel_shm_bench");
+    client.open();
+    client.enable();
+    client.AO.enable();
+
+    const int n = 100000;
+    Clock clock;
+    for (int i = 0; i < n; ++i)
+        hw.update_input();
+    Time direct = clock.restart();
+    for (int i = 0; i < n; ++i)
+        server.update_input();
+    Time served = clock.restart();
+    for (int i = 0; i < n; ++i) {
+        server.update_input();
+        client.update_input();
+    }
+    Time read = clock.restart() - served;
+    for (int i = 0; i < n; ++i) {
+        client.update_output();
+        server.update_output();
+    }
+    Time command = clock.restart();
+    bool match = client.AI.get_values() == hw.AI.get_values() && client.encoder.get_values() == hw.encoder.get_values();
+
+    LOG(Info) << "VirtualDaq update_input:        " << direct.as_nanoseconds() / n << " ns";
+    LOG(Info) << "Server publish overhead:        " << (served - direct).as_nanoseconds() / n << " ns";
+    LOG(Info) << "Client update_input:            " << read.as_nanoseconds() / n << " ns";
+    LOG(Info) << "Client command + server apply:  " << command.as_nanoseconds() / n << " ns";
+    LOG(Info) << "Client inputs match server:     " << (match ? "yes" : "no");
+
+    client.disable();
+    client.close();
+    server.disable();
+    server.close();
+
+    // two processes' worth of traffic over one segment
+    std::thread server_thread(serve, std::ref(running), seconds(2));
+    sleep(milliseconds(100));
+    consume(seconds(1));
+    server_thread.join();
+    return 0;
+}
@@ -0,0 +1,75 @@
+// MIT License
+//
+// MEL - Mechatronics Engine & Library
+// Copyright (c) 2019 Mechatronics and Haptic Interfaces Lab - Rice University
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// Author(s): Evan Pezent (epezent@rice.edu)
+
+#include <MEL/Daq/VirtualDaq.hpp>
+#include <MEL/Daq/SoftwareWatchdog.hpp>
+#include <MEL/Core/Timer.hpp>
+#include <MEL/Logging/Log.hpp>
+#include <MEL/Utility/System.hpp>
+#include <atomic>
+
+using namespace mel;
+
+// Runs a 1 kHz loop guarded by a SoftwareWatchdog, reports the timing margin
+// observed during normal operation, then stalls the loop to trip the
+// watchdog and measures how quickly the outputs are driven to a safe state.
+int main() {
+
+    MEL_LOG->set_max_severity(Info);
+
+    VirtualDaq daq("rig");
+    daq.open();
+    daq.enable();
+
+    Clock clock;
+    std::atomic<int64> expired_at(0);
+    SoftwareWatchdog watchdog(milliseconds(5), [&]() {
+        // safe state: zero all analog outputs
+        daq.AO.set_values(std::vector<Voltage>(daq.AO.get_channel_count(), 0.0));
+        daq.AO.update();
+        expired_at = clock.get_elapsed_time().as_nanoseconds();
+    }, 90, microseconds(250));
+
+    // normal operation
+    Timer timer(hertz(1000), Timer::Hybrid);
+    watchdog.start();
+    for (int i = 0; i < 2000; ++i) {
+        daq.update_input();
+        daq.AO.set_values(std::vector<Voltage>(daq.AO.get_channel_count(), 1.0));
+        daq.update_output();
+        watchdog.kick();
+        timer.wait();
+    }
+    LOG(Info) << "Timeout:             " << milliseconds(5);
+    LOG(Info) << "Max kick interval:   " << watchdog.get_max_kick_interval();
+    LOG(Info) << "Min margin:          " << watchdog.get_min_margin();
+
+    // stalled loop
+    Time stall_start = clock.get_elapsed_time();
+    sleep(milliseconds(20));
+    bool kicked = watchdog.kick();
+    watchdog.stop();
+
+    LOG(Info) << "Kick after stall:    " << (kicked ? "accepted" : "rejected (expired)");
+    LOG(Info) << "Expirations:         " << watchdog.get_expirations();
+    LOG(Info) << "Safe state after:    " << nanoseconds(expired_at) - stall_start << " of stall";
+    LOG(Info) << "AO[0] after expiry:  " << daq.AO.get_value(0) << " V";
+
+    daq.disable();
+    daq.close();
+    return 0;
+}
@@ -0,0 +1,76 @@
+// MIT License
+//
+// MEL - Mechatronics Engine & Library
+// Copyright (c) 2019 Mechatronics and Haptic Interfaces Lab - Rice University
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// Author(s): Evan Pezent (epezent@rice.edu)
+
+#include <MEL/Daq/VirtualDaq.hpp>
+#include <MEL/Math/WaveformBank.hpp>
+#include <MEL/Core/Timer.hpp>
+#include <MEL/Logging/Log.hpp>
+
+using namespace mel;
+
+// Streams 8 AI channels at 10 kHz while a 100 Hz loop drains them in blocks,
+// the way an EMG or force capture would run without a 10 kHz control loop.
+int main() {
+
+    MEL_LOG->set_max_severity(Info);
+
+    const std::size_t n_ch = 8;
+    const Frequency rate = hertz(10000);
+    const Time duration = seconds(2);
+
+    VirtualDaq daq("stream");
+    daq.AI.set_channel_numbers({0,1,2,3,4,5,6,7});
+    WaveformBank bank(n_ch);
+    for (std::size_t i = 0; i < n_ch; ++i) {
+        bank.set_waveform(i, Waveform(Waveform::Sin, hertz(50 + 10 * i)));
+        bank.set_noise(i, 0.05);
+    }
+    daq.AI.set_vector_source(std::ref(bank));
+    daq.open();
+    daq.enable();
+
+    std::vector<Voltage> block(1024 * n_ch);
+    uint64 total = 0, reads = 0;
+    Time read_time = Time::Zero;
+    Clock clock;
+    daq.AI.start_stream(rate);
+    Timer timer(hertz(100));
+    while (timer.get_elapsed_time() < duration) {
+        std::size_t scans;
+        do {
+            clock.restart();
+            scans = daq.AI.read_block(block.data(), 1024);
+            read_time += clock.get_elapsed_time();
+            total += scans;
+            ++reads;
+        } while (scans == 1024);
+        timer.wait();
+    }
+    Time elapsed = timer.get_elapsed_time();
+    daq.AI.stop_stream();
+
+    double expected = elapsed.as_seconds() * rate.as_hertz();
+    LOG(Info) << "Stream rate:       " << rate;
+    LOG(Info) << "Scans read:        " << total << " (expected ~" << static_cast<uint64>(expected) << ")";
+    LOG(Info) << "Overruns:          " << daq.AI.get_stream_overruns();
+    LOG(Info) << "read_block calls:  " << reads;
+    LOG(Info) << "Cost per scan:     " << read_time.as_microseconds() * 1000.0 / (total > 0 ? total : 1) << " ns";
+
+    daq.disable();
+    daq.close();
+    return 0;
+}
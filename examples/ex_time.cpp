@@ -37,6 +37,9 @@ int main(int argc, char const *argv[])
     double t1_s  = t1.as_seconds();
     int32  t2_ms = t2.as_milliseconds();
     int64  t3_us = t3.as_microseconds();
+    int64  t3_ns = t3.as_nanoseconds();
+    Time   t4    = nanoseconds(2500); // 2.5 us
+    print(t1_s, t2_ms, t3_us, t3_ns, t4);
 
     // Frequency
 
@@ -66,6 +69,16 @@ int main(int argc, char const *argv[])
     Timer hybrid_timer(milliseconds(10), Timer::WaitMode::Hybrid);
     print(hybrid_timer.wait());
 
+    // Absolute mode schedules against fixed deadlines and does not drift
+    Timer abs_timer(hertz(1000), Timer::WaitMode::Absolute);
+    abs_timer.set_busy_tail(microseconds(50));
+    abs_timer.set_catch_up_policy(Timer::CatchUpPolicy::Skip);
+    abs_timer.enable_histograms();
+    for (int i = 0; i < 1000; ++i)
+        abs_timer.wait();
+    print(abs_timer.get_elapsed_time(), abs_timer.get_elapsed_time_ideal());
+    print(abs_timer.get_histogram_table());
+
     // Time loops
 
     Time t = Time::Zero;
@@ -0,0 +1,134 @@
+// MIT License
+//
+// MEL - Mechatronics Engine & Library
+// Copyright (c) 2019 Mechatronics and Haptic Interfaces Lab - Rice University
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// Author(s): Evan Pezent (epezent@rice.edu)
+
+#include <MEL/Math/Trajectory.hpp>
+#include <MEL/Math/Waveform.hpp>
+#include <MEL/Core/Clock.hpp>
+#include <MEL/Core/LatencyHistogram.hpp>
+#include <MEL/Core/Timer.hpp>
+#include <MEL/Logging/Log.hpp>
+#include <MEL/Utility/System.hpp>
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <thread>
+
+using namespace mel;
+
+// Plans a trapezoidal move and a spline for a 7-DOF arm, then streams
+// minimum-jerk waypoints from a second thread while a 1 kHz loop follows the
+// trajectory. Reports the per-tick evaluation cost against per-tick Waveform
+// synthesis, the peak velocity/acceleration of the trapezoidal move, and, as
+// a continuity check, the fastest change in position between ticks against
+// the fastest velocity the trajectory itself reports.
+int main() {
+
+    MEL_LOG->set_max_severity(Info);
+
+    const std::size_t dof = 7;
+    std::vector<double> max_vel(dof, 1.0), max_acc(dof, 4.0);
+    std::vector<double> home(dof, 0.0), goal(dof);
+    for (std::size_t j = 0; j < dof; ++j)
+        goal[j] = 0.2 * (j + 1);
+
+    // planned: trapezoidal move then a spline through three waypoints
+    Trajectory traj(dof);
+    traj.reset(home);
+    traj.add_trapezoidal(goal, max_vel, max_acc);
+    std::vector<std::vector<double>> waypoints(3, std::vector<double>(dof));
+    for (std::size_t j = 0; j < dof; ++j) {
+        waypoints[0][j] = goal[j] + 0.3;
+        waypoints[1][j] = goal[j] - 0.2;
+        waypoints[2][j] = 0.0;
+    }
+    traj.add_spline(waypoints, { milliseconds(500), milliseconds(1000), milliseconds(1500) });
+
+    // cost of one evaluation over the whole plan (not in the control loop)
+    LatencyHistogram traj_cost, wave_cost;
+    std::vector<Waveform> waves(dof, Waveform(Waveform::Sin, seconds(2), 0.5));
+    std::vector<double> wave_ref(dof);
+    Clock clock;
+    {
+        Trajectory bench(dof);
+        bench.reset(home);
+        bench.add_trapezoidal(goal, max_vel, max_acc);
+        bench.update(Time::Zero);
+        for (int i = 0; i < 10000; ++i) {
+            Time t = microseconds(100 * i);
+            Time start = clock.get_elapsed_time();
+            bench.update(t);
+            traj_cost.record(clock.get_elapsed_time() - start);
+            start = clock.get_elapsed_time();
+            for (std::size_t j = 0; j < dof; ++j)
+                wave_ref[j] = waves[j].evaluate(t);
+            wave_cost.record(clock.get_elapsed_time() - start);
+        }
+    }
+
+    // streamed: a planner thread queues minimum-jerk moves while the loop runs
+    std::atomic<bool> planning(true);
+    std::thread planner([&]() {
+        sleep(milliseconds(1500));
+        for (int k = 0; k < 4 && planning; ++k) {
+            std::vector<double> target(dof);
+            for (std::size_t j = 0; j < dof; ++j)
+                target[j] = (k % 2 == 0 ? 0.5 : -0.5) * std::cos(0.3 * j);
+            traj.add_minimum_jerk(target, milliseconds(400));
+            sleep(milliseconds(200));
+        }
+    });
+
+    Timer timer(hertz(1000), Timer::Hybrid);
+    Time start = timer.get_elapsed_time();
+    double peak_vel = 0.0, peak_acc = 0.0, max_rate = 0.0, fastest = 0.0;
+    std::vector<double> last = home;
+    Time last_t = Time::Zero;
+    int ticks = 0;
+    while (ticks < 6000) {
+        Time t = timer.get_elapsed_time() - start;
+        const std::vector<double>& q = traj.update(t);
+        if (t < milliseconds(1400)) {
+            for (std::size_t j = 0; j < dof; ++j) {
+                peak_vel = std::max(peak_vel, std::abs(traj.get_velocities()[j]));
+                peak_acc = std::max(peak_acc, std::abs(traj.get_accelerations()[j]));
+            }
+        }
+        double dt = (t - last_t).as_seconds();
+        for (std::size_t j = 0; j < dof; ++j) {
+            if (dt > 0.0)
+                max_rate = std::max(max_rate, std::abs(q[j] - last[j]) / dt);
+            fastest = std::max(fastest, std::abs(traj.get_velocities()[j]));
+            last[j] = q[j];
+        }
+        last_t = t;
+        ++ticks;
+        if (ticks > 3000 && traj.is_done())
+            break;
+        timer.wait();
+    }
+    planning = false;
+    planner.join();
+
+    LOG(Info) << "Trajectory update (7 joints): mean " << traj_cost.get_mean() << ", max " << traj_cost.get_max();
+    LOG(Info) << "Waveform evaluate (7 joints): mean " << wave_cost.get_mean() << ", max " << wave_cost.get_max();
+    LOG(Info) << "Trapezoid peak velocity:      " << peak_vel << " (limit " << max_vel[0] << ")";
+    LOG(Info) << "Trapezoid peak acceleration:  " << peak_acc << " (limit " << max_acc[0] << ")";
+    LOG(Info) << "Fastest change between ticks: " << max_rate << " (fastest velocity " << fastest << ")";
+    LOG(Info) << "Final position joint 0:       " << traj.get_positions()[0] << " (planned " << traj.get_planned_end()[0] << ")";
+    LOG(Info) << "Ticks followed:               " << ticks;
+    return 0;
+}
@@ -0,0 +1,92 @@
+// MIT License
+//
+// MEL - Mechatronics Engine & Library
+// Copyright (c) 2019 Mechatronics and Haptic Interfaces Lab - Rice University
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// Author(s): Evan Pezent (epezent@rice.edu)
+
+#include <MEL/Daq/VirtualDaq.hpp>
+#include <MEL/Math/WaveformBank.hpp>
+#include <MEL/Logging/Log.hpp>
+#include <chrono>
+
+using namespace mel;
+
+// Runs func n times and returns the average time per call in ns
+template <typename F>
+double bench(int64 n, F func) {
+    auto t0 = std::chrono::steady_clock::now();
+    for (int64 i = 0; i < n; ++i)
+        func(i);
+    auto t1 = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(t1 - t0).count() / n;
+}
+
+int main() {
+
+    MEL_LOG->set_max_severity(Info);
+
+    const int64 n = 100000;
+    const std::size_t nch = 64;
+
+    VirtualDaq daq("bench");
+    ChanNums chs;
+    for (std::size_t i = 0; i < nch; ++i)
+        chs.push_back(static_cast<ChanNum>(i));
+    daq.AI.set_channel_numbers(chs);
+    daq.open();
+    daq.enable();
+
+    // one Waveform per channel, each at a different frequency and type
+    std::vector<Waveform> waves;
+    Waveform::Type types[] = {Waveform::Sin, Waveform::Cos, Waveform::Square, Waveform::Triangle, Waveform::Sawtooth};
+    for (std::size_t i = 0; i < nch; ++i)
+        waves.push_back(Waveform(types[i % 5], hertz(1.0 + 0.37 * i), 1.0 + 0.1 * i, 0.01 * i));
+
+    // per-channel std::function sources
+    for (std::size_t i = 0; i < nch; ++i) {
+        Waveform w = waves[i];
+        daq.AI.sources[chs[i]] = [w](Time t) mutable { return w.evaluate(t); };
+    }
+    double t_scalar = bench(n, [&](int64) { daq.update_input(); });
+
+    // one vectorized WaveformBank source
+    WaveformBank bank(nch);
+    for (std::size_t i = 0; i < nch; ++i)
+        bank.set_waveform(i, waves[i]);
+    daq.AI.set_vector_source(std::ref(bank));
+    double t_vector = bench(n, [&](int64) { daq.update_input(); });
+
+    // accuracy of the bank against Waveform::evaluate, ignoring samples that
+    // land on opposite sides of a square/sawtooth discontinuity
+    std::vector<double> values(nch);
+    double max_err = 0.0;
+    for (int k = 0; k < 10000; ++k) {
+        Time t = microseconds(k * 997);
+        bank.evaluate(t, values.data());
+        for (std::size_t i = 0; i < nch; ++i) {
+            double err = std::abs(values[i] - waves[i].evaluate(t));
+            if (err < 0.5 * waves[i].amplitude)
+                max_err = err > max_err ? err : max_err;
+        }
+    }
+
+    LOG(Info) << "Channels:                " << nch;
+    LOG(Info) << "update_input (scalar):   " << t_scalar << " ns";
+    LOG(Info) << "update_input (vector):   " << t_vector << " ns";
+    LOG(Info) << "WaveformBank max error:  " << max_err;
+
+    daq.disable();
+    daq.close();
+    return 0;
+}
@@ -0,0 +1,80 @@
+// MIT License
+//
+// MEL - Mechatronics Engine & Library
+// Copyright (c) 2019 Mechatronics and Haptic Interfaces Lab - Rice University
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// Author(s): Evan Pezent (epezent@rice.edu)
+
+#include <MEL/Daq/VirtualDaq.hpp>
+#include <MEL/Daq/VirtualPlant.hpp>
+#include <MEL/Core/Clock.hpp>
+#include <MEL/Math/Constants.hpp>
+#include <MEL/Logging/Log.hpp>
+#include <cmath>
+
+using namespace mel;
+
+// Closes a PD position loop around a simulated DC motor at 10 kHz and runs
+// it as fast as possible, reporting the speedup over real time.
+int main() {
+
+    MEL_LOG->set_max_severity(Info);
+
+    // motor: J theta'' = kt * u - b * theta', discretized with forward Euler
+    const double dt  = 0.0001;  // 10 kHz
+    const double J   = 0.001;   // inertia [kg*m^2]
+    const double b   = 0.01;    // damping [N*m*s/rad]
+    const double kt  = 0.1;     // torque per volt [N*m/V]
+    const double cpr = 2048;    // encoder counts per revolution
+    LinearPlant plant(
+        {{1.0, dt}, {0.0, 1.0 - b / J * dt}},  // A
+        {{0.0}, {kt / J * dt}},                // B
+        {{0.0, 1.0},                           // C: AI[0] = velocity
+         {4.0 * cpr / (2.0 * PI), 0.0}});      //    encoder[0] = X4 quadrature counts
+
+    VirtualDaq daq("sim");
+    daq.AI.set_channel_numbers({0});
+    daq.encoder.set_units_per_count(0, 2.0 * PI / cpr);
+    daq.set_plant(&plant, seconds(dt));
+    daq.open();
+    daq.enable();
+
+    // PD controller tracking a 1 Hz sinusoid
+    const double kp = 50.0, kd = 1.0;
+    const int64 steps = 100000; // 10 s simulated
+    double sq_err = 0.0;
+    Clock wall;
+    for (int64 k = 0; k < steps; ++k) {
+        daq.update_input();
+        double t     = daq.get_time().as_seconds();
+        double ref   = std::sin(2.0 * PI * t);
+        double ref_d = 2.0 * PI * std::cos(2.0 * PI * t);
+        double pos   = daq.encoder.get_position(0);
+        double vel   = daq.AI.get_value(0);
+        double u     = kp * (ref - pos) + kd * (ref_d - vel);
+        daq.AO.set_value(0, u);
+        daq.update_output();
+        sq_err += (ref - pos) * (ref - pos);
+    }
+    Time elapsed = wall.get_elapsed_time();
+
+    LOG(Info) << "Simulated time:    " << daq.get_time();
+    LOG(Info) << "Wall time:         " << elapsed;
+    LOG(Info) << "Speedup:           " << daq.get_time().as_seconds() / elapsed.as_seconds() << "x";
+    LOG(Info) << "Loop rate:         " << steps / elapsed.as_seconds() << " Hz";
+    LOG(Info) << "RMS tracking err:  " << std::sqrt(sq_err / steps) << " rad";
+
+    daq.disable();
+    daq.close();
+    return 0;
+}
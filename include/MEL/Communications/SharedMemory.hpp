@@ -64,14 +64,14 @@ public:
     bool is_mapped() const;
 
 private:
-    /// Opens or creates a memory map
-    static bool open_or_create(MapHandle& map, const std::string& name, std::size_t size);
+    /// Opens or creates a memory map. created is set true if it was created.
+    static bool open_or_create(MapHandle& map, const std::string& name, std::size_t size, bool& created);
 
     /// Opens a memory map if it exits
     static bool open_only(MapHandle& map, const std::string& name);
 
-    /// Closes a memory map
-    static void close(const std::string& name, MapHandle map);
+    /// Closes a memory map, removing its name if unlink is true
+    static void close(const std::string& name, MapHandle map, bool unlink);
 
     /// Maps a memory map buffer to the calling process's address space
     static void* map_buffer(MapHandle map, std::size_t size);
@@ -85,6 +85,7 @@ private:
     MapHandle map_;                ///< OS specfic handle to the memory map
     void* buffer_;                 ///< The memory buffer of the map
     bool is_mapped_;               ///< true if the SharedMemory was successfully mapped
+    bool created_;                 ///< true if this SharedMemory created the memory map
 };
 
 }  // namespace mel
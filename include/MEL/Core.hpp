@@ -20,7 +20,9 @@
 #include <MEL/Core/Console.hpp>
 #include <MEL/Core/Device.hpp>
 #include <MEL/Core/Frequency.hpp>
+#include <MEL/Core/LatencyHistogram.hpp>
 #include <MEL/Core/NonCopyable.hpp>
+#include <MEL/Core/Scheduler.hpp>
 #include <MEL/Core/Time.hpp>
 #include <MEL/Core/Timer.hpp>
 #include <MEL/Core/Timestamp.hpp>
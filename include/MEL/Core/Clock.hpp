@@ -33,6 +33,13 @@ class Timer;
 
 /// Utility class that measures elapsed time.
 class Clock {
+public:
+    /// The source all Clocks read the current time from
+    enum Source {
+        Os,  ///< OS high resolution clock (QueryPerformanceCounter, clock_gettime, etc.)
+        Tsc  ///< CPU invariant time-stamp counter, calibrated against the OS clock
+    };
+
 public:
     /// Default constructor. Clock automatically starts on construction.
     Clock();
@@ -43,13 +50,25 @@ public:
     /// Restart the clock back to zero and return elapsed time since started.
     Time restart();
 
+    /// Selects the time source for all Clocks and Timers. Selecting Tsc
+    /// calibrates the TSC against the OS clock for the given duration. Returns
+    /// false and falls back to Os if the CPU has no invariant TSC. Call this
+    /// once at startup, before any Clocks or Timers are used.
+    static bool set_source(Source source, Time calibration = milliseconds(100));
+
+    /// Gets the currently selected time source
+    static Source get_source();
+
+    /// Returns true if the CPU provides an invariant TSC usable as a Source
+    static bool is_tsc_available();
+
 private:
     friend class Timer;
 
     /// Gets the time since epoch. Relative to nothing in particular.
     static Time get_current_time();
 
-    Time start_time_;  ///< Time of last reset, in microseconds.
+    Time start_time_;  ///< Time of last reset
 };
 
 }  // namespace mel
@@ -64,7 +83,8 @@ private:
 /// mel::Clock is a lightweight class for measuring time.
 ///
 /// Its provides the most precise time that the underlying
-/// OS can achieve (generally microseconds or nanoseconds).
+/// OS can achieve (generally nanoseconds), which mel::Time
+/// carries without loss.
 /// It also ensures monotonicity, which means that the returned
 /// time can never go backward, even if the system time is
 /// changed.
@@ -82,6 +102,18 @@ private:
 /// converted to a number of seconds, milliseconds or even
 /// microseconds.
 ///
+/// By default, the OS clock is read on every call, which costs
+/// a system call or vDSO call on most platforms. On x86 CPUs with
+/// an invariant TSC, Clock::set_source(Clock::Tsc) switches all
+/// Clocks and Timers to reading the TSC directly, which is several
+/// times cheaper. The TSC is calibrated against the OS clock when
+/// selected, so times from both sources are directly comparable.
+///
+/// \code
+/// if (!mel::Clock::set_source(mel::Clock::Tsc))
+///     LOG(Warning) << "Invariant TSC not available, using OS clock";
+/// \endcode
+///
 /// \see mel::Time
 
 //==============================================================================
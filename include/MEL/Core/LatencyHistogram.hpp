@@ -0,0 +1,111 @@
+// MIT License
+//
+// MEL - Mechatronics Engine & Library
+// Copyright (c) 2019 Mechatronics and Haptic Interfaces Lab - Rice University
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// Author(s): Evan Pezent (epezent@rice.edu)
+
+#pragma once
+
+#include <MEL/Core/Time.hpp>
+#include <MEL/Logging/Table.hpp>
+#include <array>
+#include <string>
+
+namespace mel {
+
+//==============================================================================
+// CLASS DECLARATION
+//==============================================================================
+
+/// Fixed-size, allocation-free histogram of Time values
+class LatencyHistogram {
+public:
+    /// Default constructor
+    LatencyHistogram();
+
+    /// Records a value. Negative values count as zero, values above
+    /// get_highest_trackable() count as get_highest_trackable().
+    void record(Time value);
+
+    /// Clears all recorded values
+    void reset();
+
+    /// Gets the number of recorded values
+    int64 get_count() const;
+
+    /// Gets the smallest recorded value
+    Time get_min() const;
+
+    /// Gets the largest recorded value
+    Time get_max() const;
+
+    /// Gets the mean of all recorded values
+    Time get_mean() const;
+
+    /// Gets the value below which the given percentage [0-100] of recorded
+    /// values fall, accurate to the histogram resolution (~3%)
+    Time get_percentile(double percentile) const;
+
+    /// Gets a Table with one row per non-empty bucket: lower bound [ns],
+    /// upper bound [ns], count, and cumulative percentile
+    Table get_table(const std::string& name = "histogram") const;
+
+    /// Saves get_table() to a CSV file with a header row
+    bool save(const std::string& filepath) const;
+
+public:
+
+    /// Gets the largest value that can be distinguished by the histogram
+    static Time get_highest_trackable();
+
+private:
+
+    /// Number of bits of sub-bucket precision (32 sub-buckets, ~3% error)
+    static const int SubBits = 5;
+    /// Total number of buckets, covering 0 ns to ~68 s
+    static const std::size_t BucketCount = 32 * 32;
+
+    std::array<int64, BucketCount> counts_;  ///< bucket counts
+    int64 count_;                            ///< total values recorded
+    int64 min_;                              ///< min value recorded [ns]
+    int64 max_;                              ///< max value recorded [ns]
+    double sum_;                             ///< sum of values recorded [ns]
+};
+
+}  // namespace mel
+
+//==============================================================================
+// CLASS DOCUMENTATION
+//==============================================================================
+
+/// \class mel::LatencyHistogram
+/// \ingroup Core
+///
+/// mel::LatencyHistogram is a log-linear bucketed histogram in the style of
+/// HdrHistogram. Values are binned in nanoseconds with 32 linear sub-buckets
+/// per power of two, so every value is resolved to within ~3% across the full
+/// range. All storage is fixed at construction, so record() never allocates
+/// and costs only a few integer operations. It is used by mel::Timer to track
+/// per-tick lateness and compute time, but can be used standalone as well.
+///
+/// Usage example:
+/// \code
+/// mel::LatencyHistogram hist;
+/// hist.record(mel::microseconds(12));
+/// ...
+/// mel::Time p99 = hist.get_percentile(99.0);
+/// hist.save("latency.csv");
+/// \endcode
+///
+/// \see mel::Timer
@@ -0,0 +1,146 @@
+// MIT License
+//
+// MEL - Mechatronics Engine & Library
+// Copyright (c) 2019 Mechatronics and Haptic Interfaces Lab - Rice University
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// Author(s): Evan Pezent (epezent@rice.edu)
+
+#pragma once
+
+#include <MEL/Core/Timer.hpp>
+#include <MEL/Core/NonCopyable.hpp>
+#include <MEL/Logging/Table.hpp>
+#include <atomic>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace mel {
+
+//==============================================================================
+// CLASS DECLARATION
+//==============================================================================
+
+/// Runs multiple tasks at integer divisors of a base Timer rate
+class Scheduler : NonCopyable {
+public:
+    /// Execution statistics of a single task
+    struct TaskStats {
+        int64 runs;      ///< number of times the task has run
+        int64 overruns;  ///< number of runs that exceeded the task budget
+        Time  last;      ///< execution time of the most recent run
+        Time  max;       ///< longest execution time
+        Time  total;     ///< accumulated execution time
+    };
+
+public:
+    /// Constructs Scheduler with a base tick rate
+    Scheduler(Frequency base_rate, Timer::WaitMode mode = Timer::WaitMode::Absolute);
+
+    /// Registers a task that runs every divisor base ticks, starting on base
+    /// tick phase. Runs longer than budget are counted as overruns; a budget
+    /// of Time::Zero (default) means one base period. Returns the task index.
+    std::size_t add_task(const std::string& name,
+                         std::function<void()> task,
+                         int64 divisor = 1,
+                         int64 phase   = 0,
+                         Time budget   = Time::Zero);
+
+    /// Enables or disables a task without unregistering it
+    void set_task_enabled(std::size_t index, bool enabled);
+
+    /// Runs all tasks due on the current base tick, then waits for the next
+    /// one. Returns the Timer elapsed time.
+    Time tick();
+
+    /// Restarts the base Timer, then calls tick() repeatedly until stop() is
+    /// called or duration has elapsed. Task statistics are kept.
+    void run(Time duration = Time::Inf);
+
+    /// Causes run() to return after the current tick (safe from any thread)
+    void stop();
+
+    /// Resets the base tick count, Timer, and all task statistics
+    void restart();
+
+    /// Gets the number of registered tasks
+    std::size_t get_task_count() const;
+
+    /// Gets the name of a task
+    const std::string& get_task_name(std::size_t index) const;
+
+    /// Gets the execution statistics of a task
+    const TaskStats& get_task_stats(std::size_t index) const;
+
+    /// Gets a Table with one row per task: divisor, phase, runs, overruns,
+    /// and mean/max/budget execution time in microseconds
+    Table get_task_table() const;
+
+    /// Gets the base Timer (e.g. for its miss rate or histograms)
+    Timer& get_timer();
+
+private:
+    /// Registered task
+    struct Task {
+        std::string name;            ///< task name
+        std::function<void()> func;  ///< task callable
+        int64 divisor;               ///< runs every divisor base ticks
+        int64 phase;                 ///< base tick offset of first run
+        int64 next;                  ///< base tick of next run
+        Time budget;                 ///< allowed execution time per run
+        bool enabled;                ///< is the task enabled?
+        TaskStats stats;             ///< execution statistics
+    };
+
+    Timer timer_;                ///< base rate Timer
+    std::vector<Task> tasks_;    ///< registered tasks
+    std::atomic<bool> stop_;     ///< run() stop flag
+};
+
+}  // namespace mel
+
+//==============================================================================
+// CLASS DOCUMENTATION
+//==============================================================================
+
+/// \class mel::Scheduler
+/// \ingroup Core
+///
+/// mel::Scheduler is a cooperative, single-threaded multi-rate scheduler built
+/// on top of mel::Timer. Each task runs every N-th tick of the base rate, with
+/// an optional phase offset so that slow tasks sharing a divisor can be spread
+/// over different base ticks instead of all landing on the same one. Tasks run
+/// in registration order, so register the highest priority (e.g. the control
+/// task) first.
+///
+/// Base ticks are counted by the Timer, so when an overrun makes an Absolute
+/// Timer skip deadlines, the skipped ticks still count and task phases stay
+/// aligned with wall time. A task whose tick was skipped runs once on the
+/// next base tick rather than being dropped.
+///
+/// The execution time of every task run is measured and compared against the
+/// task's budget, so an expensive logging or networking task that steals time
+/// from the control task shows up in its overrun count.
+///
+/// Usage example:
+/// \code
+/// mel::Scheduler sched(mel::hertz(1000));
+/// sched.add_task("control", [&]() { ... });           // 1000 Hz
+/// sched.add_task("log",     [&]() { ... }, 10, 3);    //  100 Hz, tick 3, 13, 23...
+/// sched.add_task("share",   [&]() { ... }, 10, 7);    //  100 Hz, tick 7, 17, 27...
+/// sched.add_task("limits",  [&]() { ... }, 100, 0, mel::microseconds(200));
+/// sched.run(mel::seconds(60));
+/// print(sched.get_task_table());
+/// \endcode
+///
+/// \see mel::Timer
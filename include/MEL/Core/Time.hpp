@@ -36,7 +36,8 @@ class Frequency;
 class Time {
 public:
     /// Default constructor. Sets time value to zero. To construct valued time
-    /// objects, use mel::seconds, mel::milliseconds or mel::microseconds.
+    /// objects, use mel::seconds, mel::milliseconds, mel::microseconds or
+    /// mel::nanoseconds.
     Time();
 
     /// Overloads stream operator
@@ -51,6 +52,9 @@ public:
     /// Return the time value as a number of microseconds.
     int64 as_microseconds() const;
 
+    /// Return the time value as a number of nanoseconds.
+    int64 as_nanoseconds() const;
+
     /// Returns the reciprocal time as a Frequency
     Frequency to_frequency() const;
 
@@ -62,12 +66,13 @@ private:
     friend Time seconds(double);
     friend Time milliseconds(int32);
     friend Time microseconds(int64);
+    friend Time nanoseconds(int64);
 
-    /// Internal constructor from a number of microseconds.
-    explicit Time(int64 microseconds);
+    /// Internal constructor from a number of nanoseconds.
+    explicit Time(int64 nanoseconds);
 
 private:
-    int64 microseconds_;  ///< Time value stored as microseconds
+    int64 nanoseconds_;  ///< Time value stored as nanoseconds
 };
 
 //==============================================================================
@@ -83,6 +88,9 @@ Time milliseconds(int32 amount);
 /// Construct a time value from a number of microseconds
 Time microseconds(int64 amount);
 
+/// Construct a time value from a number of nanoseconds
+Time nanoseconds(int64 amount);
+
 //==============================================================================
 // OPERATOR OVERLOADS
 //==============================================================================
@@ -174,9 +182,12 @@ Time& operator%=(Time& left, Time right);
 ///
 /// mel::Time encapsulates a time value in a flexible way.
 /// It allows to define a time value either as a number of
-/// seconds, milliseconds or microseconds. It also works the
-/// other way round: you can read a time value as either
-/// a number of seconds, milliseconds or microseconds.
+/// seconds, milliseconds, microseconds or nanoseconds. It also
+/// works the other way round: you can read a time value as either
+/// a number of seconds, milliseconds, microseconds or nanoseconds.
+///
+/// Internally, time values are stored as a 64-bit number of
+/// nanoseconds, which covers roughly +/- 292 years.
 ///
 /// By using such a flexible interface, the API doesn't
 /// impose any fixed type or resolution for time values,
@@ -199,6 +210,9 @@ Time& operator%=(Time& left, Time right);
 ///
 /// mel::Time t3 = mel::microseconds(-800000);
 /// double sec = t3.as_seconds(); // -0.8
+///
+/// mel::Time t4 = mel::nanoseconds(2500);
+/// int64 nano = t4.as_nanoseconds(); // 2500
 /// \endcode
 ///
 /// \code
@@ -211,7 +225,7 @@ Time& operator%=(Time& left, Time right);
 /// \endcode
 ///
 /// \see mel::Clock, mel::Timer, mel::seconds, mel::milliseconds,
-/// mel::microseconds
+/// mel::microseconds, mel::nanoseconds
 
 //==============================================================================
 // LICENSES
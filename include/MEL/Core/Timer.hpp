@@ -19,6 +19,8 @@
 
 #include <MEL/Core/Clock.hpp>
 #include <MEL/Core/Frequency.hpp>
+#include <MEL/Core/LatencyHistogram.hpp>
+#include <memory>
 
 namespace mel {
 
@@ -38,11 +40,24 @@ public:
     /// use Busy. On real-time Linux, threads can sleep for much smaller
     /// periods, so Sleep and Hybrid can be used reliably. Generally, using
     /// Hybrid over Sleep will be more accurate since Sleep can go over the
-    /// requested sleep period.
+    /// requested sleep period. Absolute schedules each tick against the fixed
+    /// deadline start + k * period rather than the end of the previous wait,
+    /// so wakeup overshoot does not accumulate into long-run drift. Adaptive
+    /// works like Hybrid, but learns how much the OS oversleeps and busy waits
+    /// only as long as needed to meet a target miss rate.
     enum WaitMode {
         Busy,     ///< Waits 100% remaining time using a busy while loop
         Sleep,    ///< Waits 100% remaining time by sleeping the thread
-        Hybrid    ///< Waits 90% remaining time using Sleep, then 10% using Busy
+        Hybrid,   ///< Waits 90% remaining time using Sleep, then 10% using Busy
+        Absolute, ///< Sleeps until absolute deadline, optionally busy waits tail
+        Adaptive  ///< Sleeps, then busy waits a self-calibrated window
+    };
+
+    /// What an Absolute mode Timer does when one or more deadlines have
+    /// already passed by the time wait() is called.
+    enum CatchUpPolicy {
+        Skip,  ///< Drops missed ticks and realigns to the next future deadline
+        Burst  ///< Returns immediately until all missed ticks have been run
     };
 
 public:
@@ -52,6 +67,12 @@ public:
     /// Constructs Timer from wait period. Starts the Timer on construction.
     Timer(Time period, WaitMode mode = WaitMode::Busy, bool emit_warnings = true);
 
+    /// Copy constructor. Copies the histograms, if any, by value.
+    Timer(const Timer& other);
+
+    /// Copy assignment. Copies the histograms, if any, by value.
+    Timer& operator=(const Timer& other);
+
     /// Destructor
     ~Timer();
 
@@ -95,16 +116,73 @@ public:
     /// Disable deadline miss warnings
     void disable_warnings();
 
+    /// Sets the Absolute mode catch-up policy (default Skip)
+    void set_catch_up_policy(CatchUpPolicy policy);
+
+    /// Sets the portion of each Absolute mode wait that is busy waited after
+    /// sleeping (default Time::Zero, i.e. sleep the entire wait)
+    void set_busy_tail(Time tail);
+
+    /// Sets the fraction of sleeps the Adaptive mode allows to overrun its
+    /// busy wait window (default 0.001 = 0.1%)
+    void set_adaptive_target(double miss_rate);
+
+    /// Gets the Adaptive mode's current busy wait window
+    Time get_busy_window() const;
+
+    /// Starts recording per-tick lateness, compute time, and period
+    /// histograms. The histograms are allocated on the first call.
+    void enable_histograms();
+
+    /// Stops recording histograms (recorded values are kept)
+    void disable_histograms();
+
+    /// Gets the histogram of wakeup lateness, i.e. how long after its
+    /// deadline each call to wait() returned
+    const LatencyHistogram& get_lateness_histogram() const;
+
+    /// Gets the histogram of compute time, i.e. how long after the previous
+    /// wait() returned the next call to wait() was made
+    const LatencyHistogram& get_compute_histogram() const;
+
+    /// Gets the histogram of tick period, i.e. the time between the returns
+    /// of consecutive calls to wait(). Its spread is the period jitter.
+    const LatencyHistogram& get_period_histogram() const;
+
+    /// Gets a Table of the 50th, 90th, 99th, 99.9th and 100th percentiles of
+    /// lateness, compute time, and period in microseconds
+    Table get_histogram_table() const;
+
+private:
+    /// Implements wait() for the Absolute WaitMode
+    void wait_absolute(Time now);
+
+    /// Implements the sleep and busy wait for the Adaptive WaitMode
+    void wait_adaptive(Time deadline, Time now);
+
+    /// Counts a deadline miss and logs a warning if the miss rate is too high
+    void count_miss(int64 count = 1);
+
 protected:
-    WaitMode mode_;   ///< the Timer's waiting mode
-    Clock clock_;     ///< the Timer's internal clock
-    Time period_;     ///< the Timer's waiting period
-    int64 ticks_;     ///< the running tick count
-    int64 misses_;    ///< number of misses
-    Time prev_time_;  ///< time saved at previous call to wait or restart
-    Time waited_;     ///< accumulated wait time
-    double rate_;     ///< acceptable miss rate
-    bool warnings_;   ///< emit warnings?
+    WaitMode mode_;         ///< the Timer's waiting mode
+    Clock clock_;           ///< the Timer's internal clock
+    Time period_;           ///< the Timer's waiting period
+    int64 ticks_;           ///< the running tick count
+    int64 misses_;          ///< number of misses
+    Time prev_time_;        ///< time saved at previous call to wait or restart
+    Time waited_;           ///< accumulated wait time
+    double rate_;           ///< acceptable miss rate
+    bool warnings_;         ///< emit warnings?
+    CatchUpPolicy policy_;  ///< Absolute mode catch-up policy
+    Time busy_tail_;        ///< Absolute mode busy wait tail
+    Time deadline_;         ///< Absolute mode next tick deadline
+    bool histograms_;       ///< record histograms?
+    std::unique_ptr<LatencyHistogram> lateness_hist_;  ///< wakeup lateness histogram
+    std::unique_ptr<LatencyHistogram> compute_hist_;   ///< compute time histogram
+    std::unique_ptr<LatencyHistogram> period_hist_;    ///< tick period histogram
+    double adaptive_target_;                           ///< Adaptive mode target miss rate
+    Time busy_window_;                                 ///< Adaptive mode busy wait window
+    std::unique_ptr<LatencyHistogram> oversleep_hist_; ///< Adaptive mode sleep overshoot
 };
 
 }  // namespace mel
@@ -129,6 +207,19 @@ protected:
 /// both, Sleeping for the first 90% of the remaining wait time and Busy waiting
 /// for the last 10%. Prefer Hybrid wait on real-time Linux operating systems.
 ///
+/// Hybrid's fixed 90/10 split either wastes CPU when the OS wakes up on time
+/// or misses deadlines when it oversleeps. Adaptive measures the oversleep of
+/// every sleep on the current host and, over windows of at least 1000 sleeps,
+/// sets the busy wait window to the oversleep percentile that matches the
+/// target miss rate (see set_adaptive_target()). The window starts at 10% of
+/// the period and is capped at 50% of it.
+///
+/// Busy, Sleep, Hybrid, and Adaptive measure each period from the end of the previous
+/// wait, so any overshoot is added to the schedule. Absolute instead waits for
+/// the fixed deadlines start + k * period (using clock_nanosleep with
+/// TIMER_ABSTIME on Linux), so the long-run frequency matches the requested
+/// one exactly. Missed deadlines are handled according to the CatchUpPolicy.
+///
 /// Usage example:
 /// \code
 /// // create a 1000 Hz timer that uses a Busy waiting mode
@@ -145,6 +236,28 @@ protected:
 ///     ...
 ///     my_timer.wait();
 /// }
+/// ...
+/// // drift-free 1000 Hz timer that busy waits the last 50 us of each tick
+/// mel::Timer abs_timer(mel::hertz(1000), Timer::WaitMode::Absolute);
+/// abs_timer.set_busy_tail(mel::microseconds(50));
+/// abs_timer.set_catch_up_policy(Timer::CatchUpPolicy::Skip);
+/// \endcode
+///
+/// To qualify a loop, call enable_histograms(). Each wait() then records its
+/// wakeup lateness, the preceding compute time, and the tick-to-tick period
+/// into fixed-size mel::LatencyHistogram objects (no allocation after
+/// enable_histograms(), tens of nanoseconds per tick), which can be queried
+/// for percentiles or dumped to Table/CSV. The histograms are ~8 KB each, so
+/// they are only allocated by enable_histograms() (and, for Adaptive mode,
+/// by the constructor):
+/// \code
+/// my_timer.enable_histograms();
+/// ...
+/// mel::Time p99 = my_timer.get_lateness_histogram().get_percentile(99.0);
+/// mel::Time jitter = my_timer.get_period_histogram().get_max() -
+///                    my_timer.get_period_histogram().get_min();
+/// mel::Table::write("timer.tbl", my_timer.get_histogram_table());
+/// my_timer.get_lateness_histogram().save("lateness.csv");
 /// \endcode
 
 /// \see mel::Clock, mel::Time
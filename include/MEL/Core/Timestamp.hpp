@@ -49,6 +49,7 @@ public:
     int min;       ///< minute                   [0-59]
     int sec;       ///< second                   [0-59]
     int millisec;  ///< millisecond              [0-999]
+    int nanosec;   ///< nanosecond of the second [0-999999999]
 };
 
 }  // namespace mel
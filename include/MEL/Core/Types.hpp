@@ -69,10 +69,6 @@ typedef uint32 ChanNum;
 /// An array of channel numbers
 typedef std::vector<ChanNum> ChanNums;
 
-/// Maps a channel number to an array index
-// typdef channel number(s)
-typedef std::map<uint32, std::size_t> ChanMap;
-
 /// Represents a voltage in [V]
 typedef double Voltage;
 
@@ -0,0 +1,234 @@
+// MIT License
+//
+// MEL - Mechatronics Engine & Library
+// Copyright (c) 2019 Mechatronics and Haptic Interfaces Lab - Rice University
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// Author(s): Evan Pezent (epezent@rice.edu)
+
+#pragma once
+
+#include <MEL/Daq/DaqBase.hpp>
+#include <MEL/Daq/Input.hpp>
+#include <MEL/Daq/Output.hpp>
+#include <MEL/Daq/Encoder.hpp>
+#include <MEL/Core/Clock.hpp>
+#include <MEL/Core/Frequency.hpp>
+#include <MEL/Utility/RealtimeThread.hpp>
+#include <MEL/Utility/TripleBuffer.hpp>
+#include <atomic>
+
+namespace mel {
+
+class AsyncDaq;
+
+//==============================================================================
+// ASYNC MODULES
+//==============================================================================
+
+class AsyncAI : public AnalogInput {
+public:
+    AsyncAI(AsyncDaq& daq, const ChanNums& channel_numbers);
+    bool update_channel(ChanNum channel_number) override;
+    bool update_channels(const ChanNums& channel_numbers) override;
+private:
+    AsyncDaq& daq_;
+};
+
+class AsyncDI : public DigitalInput {
+public:
+    AsyncDI(AsyncDaq& daq, const ChanNums& channel_numbers);
+    bool update_channel(ChanNum channel_number) override;
+    bool update_channels(const ChanNums& channel_numbers) override;
+private:
+    AsyncDaq& daq_;
+};
+
+class AsyncEncoder : public Encoder {
+public:
+    AsyncEncoder(AsyncDaq& daq, const ChanNums& channel_numbers);
+    bool update_channel(ChanNum channel_number) override;
+    bool update_channels(const ChanNums& channel_numbers) override;
+    bool reset_count(ChanNum channel_number, int count) override;
+private:
+    AsyncDaq& daq_;
+};
+
+class AsyncAO : public AnalogOutput {
+public:
+    AsyncAO(AsyncDaq& daq, const ChanNums& channel_numbers);
+    bool update_channel(ChanNum channel_number) override;
+    bool update_channels(const ChanNums& channel_numbers) override;
+private:
+    AsyncDaq& daq_;
+};
+
+class AsyncDO : public DigitalOutput {
+public:
+    AsyncDO(AsyncDaq& daq, const ChanNums& channel_numbers);
+    bool update_channel(ChanNum channel_number) override;
+    bool update_channels(const ChanNums& channel_numbers) override;
+private:
+    AsyncDaq& daq_;
+};
+
+//==============================================================================
+// ASYNC DAQ
+//==============================================================================
+
+/// Runs another DAQ's I/O on a dedicated thread so the control loop never blocks
+class AsyncDaq : public DaqBase {
+public:
+    /// I/O statistics
+    struct Stats {
+        uint64 io_cycles;       ///< read/write cycles completed by the I/O thread
+        uint64 dropped_inputs;  ///< snapshots overwritten before the control thread read them
+        uint64 stale_inputs;    ///< AsyncDaq::update_input() calls that found no new snapshot
+        uint64 output_commands; ///< update_output() calls from the control thread
+        uint64 dropped_outputs; ///< commands overwritten before the I/O thread wrote them
+        Time max_input_age;     ///< oldest snapshot handed out by update_input()
+    };
+
+public:
+    /// Constructor. Any Module may be nullptr if the wrapped DAQ does not have
+    /// it. The I/O thread updates the wrapped DAQ at io_rate with the given
+    /// RealtimeThread priority (0 leaves the OS default). The wrapped DAQ must
+    /// outlive this AsyncDaq and must not be touched directly while enabled.
+    AsyncDaq(const std::string& name,
+             DaqBase& daq,
+             Module<Voltage>* ai,
+             Module<Logic>* di,
+             Module<int32>* encoder,
+             Module<Voltage>* ao,
+             Module<Logic>* dout,
+             Frequency io_rate = hertz(1000),
+             int priority = 0);
+
+    /// Destructor
+    ~AsyncDaq();
+
+    /// Copies the latest input snapshot into AI, DI and encoder. Never blocks.
+    bool update_input() override;
+
+    /// Hands the current AO and DO values to the I/O thread. Never blocks.
+    bool update_output() override;
+
+    /// Gets the time the current input snapshot was read, since open
+    Time get_input_timestamp() const;
+
+    /// Gets how long ago the current input snapshot was read
+    Time get_input_age() const;
+
+    /// Gets I/O statistics since the last enable
+    Stats get_stats() const;
+
+public:
+    AsyncAI AI;
+    AsyncDI DI;
+    AsyncEncoder encoder;
+    AsyncAO AO;
+    AsyncDO DO;
+
+protected:
+    bool on_open() override;
+    bool on_close() override;
+    bool on_enable() override;
+    bool on_disable() override;
+
+private:
+    /// Values read by the I/O thread
+    struct InputFrame {
+        std::vector<Voltage> ai;
+        std::vector<Logic> di;
+        std::vector<int32> encoder;
+        Time timestamp;
+    };
+
+    /// Values commanded by the control thread
+    struct OutputFrame {
+        std::vector<Voltage> ao;
+        std::vector<Logic> dout;
+    };
+
+    /// Copies the latest input snapshot, if there is a new one, into AI, DI
+    /// and encoder. Returns false if the current snapshot was already consumed.
+    bool consume_input();
+
+    /// I/O thread loop
+    void io_loop();
+
+    friend class AsyncAI;
+    friend class AsyncDI;
+    friend class AsyncEncoder;
+
+private:
+    DaqBase& daq_;                      ///< wrapped DAQ
+    Module<Voltage>* ai_;               ///< wrapped AI
+    Module<Logic>* di_;                 ///< wrapped DI
+    Module<int32>* encoder_;            ///< wrapped encoder
+    Module<Voltage>* ao_;               ///< wrapped AO
+    Module<Logic>* dout_;               ///< wrapped DO
+    Frequency io_rate_;                 ///< I/O thread rate
+    RealtimeThread thread_;             ///< I/O thread
+    std::atomic<bool> running_;         ///< I/O thread run flag
+    Clock clock_;                       ///< timestamps snapshots
+    TripleBuffer<InputFrame> inputs_;   ///< I/O thread -> control thread
+    TripleBuffer<OutputFrame> outputs_; ///< control thread -> I/O thread
+    Time input_timestamp_;              ///< timestamp of current snapshot
+    std::atomic<uint64> io_cycles_;     ///< written by the I/O thread
+    std::atomic<uint64> dropped_inputs_;///< written by the I/O thread
+    uint64 dropped_outputs_;            ///< written by the control thread
+    uint64 stale_inputs_;               ///< written by the control thread
+    uint64 output_commands_;            ///< written by the control thread
+    Time max_input_age_;                ///< written by the control thread
+};
+
+}  // namespace mel
+
+//==============================================================================
+// CLASS DOCUMENTATION
+//==============================================================================
+
+/// \class mel::AsyncDaq
+/// \ingroup Daq
+///
+/// AsyncDaq takes the blocking USB/PCI transaction out of the control loop.
+/// While enabled, a dedicated I/O thread repeatedly writes the latest output
+/// command to the wrapped DAQ, reads its inputs, and publishes a timestamped
+/// snapshot. The control thread exchanges data with it through two
+/// TripleBuffers, so update_input() and update_output() cost a vector copy
+/// and never wait on hardware or locks.
+///
+/// The control thread reads and writes the AsyncDaq's own AI, DI, encoder,
+/// AO and DO Modules, which mirror the channel numbers of the wrapped ones.
+/// Configure encoder units on the AsyncDaq encoder. Inputs are always one
+/// I/O cycle old; get_input_age() and get_stats() report how old, and how
+/// often the control loop saw the same snapshot twice. Updating a single input
+/// Module takes the latest snapshot as well, but only AsyncDaq::update_input()
+/// counts stale snapshots, so mixing per-Module updates in one tick does not
+/// skew the statistics.
+///
+/// Usage example:
+/// \code
+/// Q8Usb q8;
+/// AsyncDaq daq("async", q8, &q8.AI, nullptr, &q8.encoder, &q8.AO, nullptr, hertz(2000), 90);
+/// daq.open();
+/// daq.enable();
+/// while (running) {
+///     daq.update_input();   // latest snapshot, no USB wait
+///     daq.AO[0] = control(daq.encoder[0].get_position());
+///     daq.update_output();  // queued for the I/O thread
+///     timer.wait();
+/// }
+/// \endcode
+///
+/// \see TripleBuffer, RealtimeThread
@@ -0,0 +1,111 @@
+// MIT License
+//
+// MEL - Mechatronics Engine & Library
+// Copyright (c) 2019 Mechatronics and Haptic Interfaces Lab - Rice University
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// Author(s): Evan Pezent (epezent@rice.edu)
+
+#pragma once
+
+#include <MEL/Core/Types.hpp>
+#include <algorithm>
+#include <stdexcept>
+
+namespace mel {
+
+//==============================================================================
+// CLASS DECLARATION
+//==============================================================================
+
+/// Maps a channel number to an array index
+class ChanMap {
+public:
+    /// Default constructor (empty map)
+    ChanMap();
+
+    /// Constructs map where channel_numbers[i] maps to index i
+    explicit ChanMap(const ChanNums& channel_numbers);
+
+    /// Returns the index of a channel number, or ChanMap::npos if not mapped
+    std::size_t find(ChanNum channel_number) const;
+
+    /// Returns 1 if a channel number is mapped, 0 otherwise
+    std::size_t count(ChanNum channel_number) const;
+
+    /// Returns the index of a channel number. Throws std::out_of_range if
+    /// the channel number is not mapped.
+    std::size_t at(ChanNum channel_number) const;
+
+    /// Returns the number of mapped channels
+    std::size_t size() const;
+
+    /// Returns the mapped channel numbers in index order
+    const ChanNums& get_channel_numbers() const;
+
+    /// Returns true if lookups use a direct-indexed table
+    bool is_dense() const;
+
+public:
+    static const std::size_t npos;  ///< returned by find() for unmapped channels
+
+private:
+    ChanNums numbers_;                ///< channel numbers in index order
+    std::vector<std::size_t> table_;  ///< dense: index of each channel number
+    ChanNums keys_;                   ///< sparse: sorted channel numbers
+    std::vector<std::size_t> slots_;  ///< sparse: index of each key
+    bool dense_;                      ///< dense or sparse lookups?
+};
+
+//==============================================================================
+// INLINE DEFINITIONS
+//==============================================================================
+
+inline std::size_t ChanMap::find(ChanNum channel_number) const {
+    if (dense_)
+        return channel_number < table_.size() ? table_[channel_number] : npos;
+    auto it = std::lower_bound(keys_.begin(), keys_.end(), channel_number);
+    if (it != keys_.end() && *it == channel_number)
+        return slots_[it - keys_.begin()];
+    return npos;
+}
+
+inline std::size_t ChanMap::count(ChanNum channel_number) const {
+    return find(channel_number) != npos ? 1 : 0;
+}
+
+inline std::size_t ChanMap::at(ChanNum channel_number) const {
+    std::size_t i = find(channel_number);
+    if (i == npos)
+        throw std::out_of_range("ChanMap::at: channel number not mapped");
+    return i;
+}
+
+inline std::size_t ChanMap::size() const {
+    return numbers_.size();
+}
+
+}  // namespace mel
+
+//==============================================================================
+// CLASS DOCUMENTATION
+//==============================================================================
+
+/// \class mel::ChanMap
+/// \ingroup Daq
+///
+/// mel::ChanMap resolves a channel number to the index of its value in a
+/// Registry. Channel sets that are compact (e.g. 0-7, or 0-15 with gaps) use
+/// a direct-indexed table, so a lookup is a bounds check and a single array
+/// read. Sparse channel sets (e.g. {0, 1000, 50000}) fall back to a binary
+/// search over a flat sorted array. ModuleBase rebuilds its ChanMap whenever
+/// its channel numbers change.
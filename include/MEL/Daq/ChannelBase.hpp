@@ -40,11 +40,13 @@ public:
     /// Synchronizes the channel with the real-world
     bool update();
 
-    /// Returns the current value of the channel
+    /// Returns the current value of the channel, or T() if the channel number
+    /// is no longer defined on the Module (see is_valid())
     T get_value() const;
 
-    /// Sets the current value of the channel
-    void set_value(T value);
+    /// Sets the current value of the channel. Returns false and discards the
+    /// value if the channel number is no longer defined on the Module.
+    bool set_value(T value);
 
     /// Overload assignment operator for setting
     void operator= (const T& value);
@@ -59,8 +61,16 @@ public:
     bool is_valid() const;
 
 protected:
-    Module<T>* module_;       ///< Pointer to the module this channel is on
-    ChanNum channel_number_;  ///< The channel number of this channel
+    /// Returns the index of this channel into the Module's values, resolved
+    /// once and again only after the Module's channel numbers change. An
+    /// error is logged each time resolution fails.
+    std::size_t get_index() const;
+
+protected:
+    Module<T>* module_;           ///< Pointer to the module this channel is on
+    ChanNum channel_number_;      ///< The channel number of this channel
+    mutable std::size_t index_;   ///< Cached index of channel_number_ on module_
+    mutable uint64 generation_;   ///< Module generation index_ was resolved at
 };
 
 }  // namespace mel
@@ -1,11 +1,23 @@
 namespace mel {
 
 template <typename T>
-ChannelBase<T>::ChannelBase() : module_(nullptr), channel_number_(0) {}
+ChannelBase<T>::ChannelBase() :
+    module_(nullptr),
+    channel_number_(0),
+    index_(ChanMap::npos),
+    generation_(0)
+{}
 
 template <typename T>
-ChannelBase<T>::ChannelBase(Module<T>* module, ChanNum channel_number)
-    : module_(module), channel_number_(channel_number) {}
+ChannelBase<T>::ChannelBase(Module<T>* module, ChanNum channel_number) :
+    module_(module),
+    channel_number_(channel_number),
+    index_(module->get_channel_index(channel_number)),
+    generation_(module->get_generation())
+{
+    if (index_ == ChanMap::npos)
+        module->validate_channel_number(channel_number);
+}
 
 template <typename T>
 ChannelBase<T>::~ChannelBase() {}
@@ -17,12 +29,17 @@ bool ChannelBase<T>::update() {
 
 template <typename T>
 T ChannelBase<T>::get_value() const {
-    return module_->get_value(channel_number_);
+    std::size_t i = get_index();
+    return i != ChanMap::npos ? module_->get_values()[i] : T();
 }
 
 template <typename T>
-void ChannelBase<T>::set_value(T value) {
-    module_->set_value(channel_number_, value);
+bool ChannelBase<T>::set_value(T value) {
+    std::size_t i = get_index();
+    if (i == ChanMap::npos)
+        return false;
+    module_->get_values()[i] = value;
+    return true;
 }
 
 template <typename T>
@@ -44,9 +61,19 @@ template <typename T>
 bool ChannelBase<T>::is_valid() const {
     if (module_ == nullptr)
         return false;
-    if (!module_->validate_channel_number(channel_number_))
-        return false;
-    return true;
+    return get_index() != ChanMap::npos;
+}
+
+template <typename T>
+std::size_t ChannelBase<T>::get_index() const {
+    if (generation_ != module_->get_generation()) {
+        index_      = module_->get_channel_index(channel_number_);
+        generation_ = module_->get_generation();
+        // logs once per channel number change rather than on every access
+        if (index_ == ChanMap::npos)
+            module_->validate_channel_number(channel_number_);
+    }
+    return index_;
 }
 
 } // namespace mel
@@ -2,12 +2,18 @@ namespace mel {
 
     template<typename T>
     Input<T>::Input() : 
-        Module<T>()
+        Module<T>(),
+        stream_buffer_(0),
+        streaming_(false),
+        stream_overruns_(0)
     {}
 
     template<typename T>
     Input<T>::Input(const ChanNums& channel_numbers) : 
-        Module<T>(channel_numbers) 
+        Module<T>(channel_numbers),
+        stream_buffer_(0),
+        streaming_(false),
+        stream_overruns_(0)
     { }
 
     template<typename T>
@@ -40,6 +46,93 @@ namespace mel {
         return get_channels(channel_numbers);
     }
 
+    template <typename T>
+    bool Input<T>::start_stream(Frequency sample_rate, std::size_t buffer_scans) {
+        if (streaming_ || sample_rate.as_hertz() <= 0 || buffer_scans == 0 || this->get_channel_count() == 0)
+            return false;
+        stream_buffer_.resize(buffer_scans * this->get_channel_count());
+        stream_buffer_.clear();
+        stream_rate_     = sample_rate;
+        stream_overruns_ = 0;
+        if (!on_start_stream(sample_rate))
+            return false;
+        streaming_ = true;
+        return true;
+    }
+
+    template <typename T>
+    std::size_t Input<T>::read_block(T* buffer, std::size_t max_scans) {
+        if (!streaming_)
+            return 0;
+        on_read_stream();
+        std::size_t n_ch  = this->get_channel_count();
+        std::size_t scans = std::min(max_scans, stream_buffer_.size() / n_ch);
+        for (std::size_t i = 0; i < scans * n_ch; ++i)
+            buffer[i] = stream_buffer_.pop_front();
+        return scans;
+    }
+
+    template <typename T>
+    bool Input<T>::stop_stream() {
+        if (!streaming_)
+            return true;
+        streaming_ = false;
+        stream_buffer_.clear();
+        return on_stop_stream();
+    }
+
+    template <typename T>
+    bool Input<T>::is_streaming() const {
+        return streaming_;
+    }
+
+    template <typename T>
+    Frequency Input<T>::get_stream_rate() const {
+        return stream_rate_;
+    }
+
+    template <typename T>
+    uint64 Input<T>::get_stream_overruns() const {
+        return stream_overruns_;
+    }
+
+    template <typename T>
+    bool Input<T>::on_start_stream(Frequency /*sample_rate*/) {
+        // streaming is unsupported unless overridden
+        return false;
+    }
+
+    template <typename T>
+    bool Input<T>::on_stop_stream() {
+        return true;
+    }
+
+    template <typename T>
+    void Input<T>::on_read_stream() { }
+
+    template <typename T>
+    void Input<T>::push_scan(const T* scan) {
+        std::size_t n_ch = this->get_channel_count();
+        if (stream_buffer_.capacity() - stream_buffer_.size() < n_ch) {
+            for (std::size_t i = 0; i < n_ch; ++i)
+                stream_buffer_.pop_front();
+            ++stream_overruns_;
+        }
+        for (std::size_t i = 0; i < n_ch; ++i)
+            stream_buffer_.push_back(scan[i]);
+    }
+
+    template <typename T>
+    std::size_t Input<T>::get_stream_capacity() const {
+        std::size_t n_ch = this->get_channel_count();
+        return n_ch > 0 ? stream_buffer_.capacity() / n_ch : 0;
+    }
+
+    template <typename T>
+    void Input<T>::add_stream_overruns(uint64 scans) {
+        stream_overruns_ += scans;
+    }
+
     template <typename T>
     Input<T>::Channel::Channel() : ChannelBase<T>() { }
 
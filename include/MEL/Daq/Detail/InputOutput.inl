@@ -38,21 +38,12 @@ namespace mel {
 
     template <typename T>
     bool InputOutput<T>::update_input() {
-        auto chnums = get_input_channel_numbers();
-        bool success = true;
-        for (auto& c : chnums)
-            success = this->update_channel(c) ? success : false;
-        return success;
+        return this->update_channels(input_channel_numbers_);
     }
 
     template <typename T>
     bool InputOutput<T>::update_output() {
-        
-        auto chnums = get_output_channel_numbers();
-        bool success = true;
-        for (auto& c : chnums)
-            success = this->update_channel(c) ? success : false;
-        return success;
+        return this->update_channels(output_channel_numbers_);
     }
 
     template <typename T>
@@ -9,7 +9,7 @@ namespace mel {
         RegistryBase(module),
         default_value_(default_value)
     { 
-        values_.resize(this->module_->get_channel_count());        
+        values_.resize(this->map_->size());
         std::fill(values_.begin(), values_.end(), default_value_);
     }
 
@@ -54,9 +54,11 @@ namespace mel {
                                 const ChanMap& new_map)
     {
         std::vector<T> new_values(new_map.size(), default_value_);
-        for (auto it = old_map.begin(); it != old_map.end(); ++it) {
-            if (new_map.count(it->first))
-                new_values[new_map.at(it->first)] = values_[old_map.at(it->first)];
+        const ChanNums& old_numbers = old_map.get_channel_numbers();
+        for (std::size_t i = 0; i < old_numbers.size(); ++i) {
+            std::size_t j = new_map.find(old_numbers[i]);
+            if (j != ChanMap::npos)
+                new_values[j] = values_[i];
         }
         values_ = new_values;
     }
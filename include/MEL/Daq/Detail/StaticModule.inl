@@ -0,0 +1,57 @@
+namespace mel {
+
+template <class Base, ChanNum... Channels>
+template <typename... Args>
+StaticModule<Base, Channels...>::StaticModule(Args&&... args) :
+    Base(std::forward<Args>(args)...)
+{
+    Base::set_channel_numbers(ChanNums{Channels...});
+}
+
+template <class Base, ChanNum... Channels>
+constexpr std::size_t StaticModule<Base, Channels...>::size() {
+    return sizeof...(Channels);
+}
+
+template <class Base, ChanNum... Channels>
+template <ChanNum Ch>
+constexpr std::size_t StaticModule<Base, Channels...>::index() {
+    static_assert(Contains<Ch>::value, "Channel number is not on this StaticModule");
+    return detail::StaticIndex<Ch, Channels...>::value;
+}
+
+template <class Base, ChanNum... Channels>
+template <ChanNum Ch>
+typename StaticModule<Base, Channels...>::Value StaticModule<Base, Channels...>::get() const {
+    return this->values_.get()[index<Ch>()];
+}
+
+template <class Base, ChanNum... Channels>
+template <ChanNum Ch>
+void StaticModule<Base, Channels...>::set(Value value) {
+    this->values_.get()[index<Ch>()] = value;
+}
+
+template <class Base, ChanNum... Channels>
+template <ChanNum Ch>
+bool StaticModule<Base, Channels...>::update_channel() {
+    static_assert(Contains<Ch>::value, "Channel number is not on this StaticModule");
+    return this->update_channel(Ch);
+}
+
+template <class Base, ChanNum... Channels>
+void StaticModule<Base, Channels...>::set_channel_numbers(const ChanNums& /*channel_numbers*/) {
+    detail::warn_static_channel_numbers(*this, "set_channel_numbers");
+}
+
+template <class Base, ChanNum... Channels>
+void StaticModule<Base, Channels...>::add_channel_number(ChanNum /*channel_number*/) {
+    detail::warn_static_channel_numbers(*this, "add_channel_number");
+}
+
+template <class Base, ChanNum... Channels>
+void StaticModule<Base, Channels...>::remove_channel_number(ChanNum /*channel_number*/) {
+    detail::warn_static_channel_numbers(*this, "remove_channel_number");
+}
+
+} // namespace mel
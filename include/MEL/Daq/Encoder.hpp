@@ -21,6 +21,7 @@
 #include <MEL/Mechatronics/VelocitySensor.hpp>
 #include <MEL/Daq/ChannelBase.hpp>
 #include <MEL/Daq/Module.hpp>
+#include <MEL/Core/Clock.hpp>
 
 namespace mel {
 
@@ -28,6 +29,14 @@ namespace mel {
 class Encoder : public Module<int> {
 public:
     class Channel;
+    class VelocityChannel;
+
+    /// Software velocity estimation techniques
+    enum VelocityEstimator {
+        FixedTime,      ///< counts/time over each sample, low-passed with time constant parameter [s] (0 = raw)
+        FixedPosition,  ///< time between every parameter counts (edge timing), decaying when no edges arrive
+        TrackingLoop    ///< PLL/steady-state Kalman position tracker with bandwidth parameter [rad/s]
+    };
 
     /// Default Constructor (creates an invlaid empty Encoder)
     Encoder();
@@ -62,6 +71,31 @@ public:
     /// Performs conversion to positions using factors_ and counts_per_unit
     const std::vector<double>& get_positions();
 
+    /// Updates counts of all channels, then estimates their velocities
+    virtual bool update() override;
+
+    /// Sets the velocity estimator and its parameter on all channels
+    void set_velocity_estimator(VelocityEstimator estimator, double parameter);
+
+    /// Sets the velocity estimator and its parameter on a single channel
+    void set_velocity_estimator(ChanNum channel_number, VelocityEstimator estimator, double parameter);
+
+    /// Advances the velocity estimates of all channels in one pass using the
+    /// current counts, which were sampled at timestamp. Called by update().
+    void estimate_velocities(Time timestamp);
+
+    /// Clears estimator state; the next estimate_velocities() reinitializes
+    void reset_velocity_estimates();
+
+    /// Gets the estimated velocity of a single channel in units per second
+    double get_velocity_estimate(ChanNum channel_number);
+
+    /// Gets the estimated velocities of all channels in units per second
+    const std::vector<double>& get_velocity_estimates();
+
+    /// Returns a VelocitySensor reading a channel's velocity estimate
+    VelocityChannel get_velocity_channel(ChanNum channel_number);
+
     /// Returns a Encoder::Channel
     Channel get_channel(ChanNum channel_number);
 
@@ -88,6 +122,16 @@ protected:
     /// Precomputes position conversion sclars (i.e. units_per_count_ / factors_)
     void compute_conversions();
 
+    /// Updates the counts of all channels for update(). By default, calls
+    /// update_channels() with all channel numbers; override to read every
+    /// channel in a single backend call.
+    virtual bool update_all();
+
+    /// Sets the time at which the counts being read were sampled. Call from
+    /// update_channel(s) if the DAQ timestamps its samples; otherwise update()
+    /// uses the time at which it was called.
+    void set_sample_time(Time timestamp);
+
 protected:
 
     Registry<QuadFactor> factors_;      ///< The encoder quadrature factors (default X4)
@@ -95,6 +139,20 @@ protected:
     Registry<double> positions_;        ///< The calculated positions of the Encoder channels
     Registry<double> conversions_;      ///< Conversion scalars used to convert to positions
 
+    Registry<VelocityEstimator> estimators_;  ///< The velocity estimator of each channel
+    Registry<double> estimator_params_;       ///< The velocity estimator parameter of each channel
+    Registry<double> counts_per_sec_;         ///< The estimated velocities [counts/s]
+    Registry<double> velocity_estimates_;     ///< The estimated velocities [units/s]
+    Registry<int> last_counts_;               ///< Counts at the previous estimate
+    Registry<int> edge_counts_;               ///< Counts at the last FixedPosition estimate
+    Registry<Time> edge_times_;               ///< Time of the last FixedPosition estimate
+    Registry<double> tracked_offsets_;        ///< TrackingLoop position estimate relative to last counts
+    Time last_estimate_time_;                 ///< Time of the previous estimate
+    Time sample_time_;                        ///< Sample time set by the DAQ
+    bool sample_time_set_;                    ///< Did the DAQ set sample_time_ this update?
+    bool estimates_primed_;                   ///< Has estimator state been initialized?
+    Clock clock_;                             ///< Fallback sample clock
+
 public:
     /// Encapsulates and Encoder channel (can be used as a PositionSensor)
     class Channel : public ChannelBase<int>, public PositionSensor {
@@ -126,6 +184,19 @@ public:
         bool set_quadrature_factor(QuadFactor factor);
 
     };
+
+    /// Exposes an Encoder channel's velocity estimate as a VelocitySensor
+    class VelocityChannel : public ChannelBase<int>, public VelocitySensor {
+    public:
+        /// Default constructor. Creates invalid channel
+        VelocityChannel();
+
+        /// Creates a valid channel.
+        VelocityChannel(Encoder* module, ChanNum channel_number);
+
+        /// Gets the estimated velocity
+        double get_velocity() override;
+    };
 };
 
 }  // namespace mel
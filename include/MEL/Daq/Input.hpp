@@ -18,6 +18,8 @@
 #pragma once
 #include <MEL/Daq/ChannelBase.hpp>
 #include <MEL/Daq/Module.hpp>
+#include <MEL/Core/Frequency.hpp>
+#include <MEL/Utility/RingBuffer.hpp>
 
 namespace mel {
 
@@ -52,6 +54,28 @@ public:
     /// Gets a vector of handles to channels on this module
     std::vector<Channel> operator[](const ChanNums& channel_numbers);
 
+    /// Starts clocked acquisition of all channels at sample_rate, buffering
+    /// up to buffer_scans scans. Returns false if the Module cannot stream,
+    /// is already streaming, or the configuration is invalid.
+    bool start_stream(Frequency sample_rate, std::size_t buffer_scans = 65536);
+
+    /// Copies up to max_scans buffered scans into buffer, interleaved in
+    /// channel number order (buffer must hold max_scans * channel count
+    /// values). Returns the number of scans copied.
+    std::size_t read_block(T* buffer, std::size_t max_scans);
+
+    /// Stops acquisition and discards any buffered scans
+    bool stop_stream();
+
+    /// Returns true if the Module is streaming
+    bool is_streaming() const;
+
+    /// Gets the stream sample rate
+    Frequency get_stream_rate() const;
+
+    /// Gets the number of scans dropped because the buffer was full
+    uint64 get_stream_overruns() const;
+
     /// Encapsulates a Module channel
     class Channel : virtual public ChannelBase<T> {
     public:
@@ -64,6 +88,34 @@ public:
         /// Inherit assignment operator for setting
         using ChannelBase<T>::operator=;
     };
+
+protected:
+
+    /// Implement to start clocked acquisition (default: unsupported)
+    virtual bool on_start_stream(Frequency sample_rate);
+
+    /// Implement to stop clocked acquisition
+    virtual bool on_stop_stream();
+
+    /// Implement to move newly acquired scans into the buffer with push_scan()
+    virtual void on_read_stream();
+
+    /// Appends one scan (channel count values) to the stream buffer, dropping
+    /// the oldest scan if the buffer is full
+    void push_scan(const T* scan);
+
+    /// Gets the stream buffer capacity in scans
+    std::size_t get_stream_capacity() const;
+
+    /// Records scans the backend dropped before they reached the buffer
+    void add_stream_overruns(uint64 scans);
+
+private:
+
+    RingBuffer<T> stream_buffer_;  ///< buffered scans, interleaved
+    Frequency stream_rate_;        ///< stream sample rate
+    bool streaming_;               ///< is the Module streaming?
+    uint64 stream_overruns_;       ///< scans dropped on a full buffer
 };
 
 //==============================================================================
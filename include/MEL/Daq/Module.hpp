@@ -18,7 +18,6 @@
 #pragma once
 #include <MEL/Core/Device.hpp>
 #include <MEL/Daq/Registry.hpp>
-#include <map>
 
 namespace mel {
 
@@ -35,16 +34,47 @@ public:
     /// Calls the Modules's API to update a single channel with the real-world.
     virtual bool update_channel(ChanNum channel_number) = 0;
 
+    /// Calls the Modules's API to update a subset of channels with the
+    /// real-world in as few backend calls as possible. By default, iteratively
+    /// calls update_channel() on each channel number. Channel numbers are not
+    /// validated here; use add_group() to build a validated subset up front.
+    virtual bool update_channels(const ChanNums& channel_numbers);
+
     /// Calls the Modules's API to update all channels with the real-world.
-    /// By default, iteratively calls update_channel() on all channel numbers.
+    /// By default, calls update_channels() with all channel numbers.
     virtual bool update();
 
+    /// Defines a group of channels that are updated together with a single
+    /// call to update_group(). Returns the group index, or -1 if any channel
+    /// number is invalid.
+    int add_group(const ChanNums& channel_numbers);
+
+    /// Updates all channels in a group previously defined with add_group()
+    bool update_group(int group);
+
+    /// Gets the channel numbers of a group previously defined with add_group()
+    const ChanNums& get_group(int group) const;
+
+    /// Returns the number of channel groups defined on this Module
+    std::size_t get_group_count() const;
+
+    /// Removes all channel groups defined on this Module
+    void clear_groups();
+
     /// Gets the vector of channel numbers this Module maintains
     const ChanNums& get_channel_numbers() const;
 
     /// Returns the number of channels on this Module
     std::size_t get_channel_count() const;
 
+    /// Returns the index of a channel number into this Module's values, or
+    /// ChanMap::npos if the channel number is not defined on this Module
+    std::size_t get_channel_index(ChanNum channel_number) const;
+
+    /// Returns a counter that is incremented every time the channel numbers
+    /// change, invalidating previously resolved channel indices
+    uint64 get_generation() const;
+
     /// Checks if a channel number is a number defined on this Module.
     /// If quiet is false, an error log will be thrown.
     bool validate_channel_number(ChanNum channel_number, bool quiet = false) const;
@@ -80,14 +110,13 @@ private:
     /// Updates the channel Map and notifies Registries
     void update_map();
 
-    /// Returns vector index associated with channel number
-    std::size_t index(uint32 channel_number) const;
-
 private:
 
     ChanNums channel_numbers_;              ///< The channel numbers used by this ModuleBase
     ChanMap  channel_map_;                  ///< Maps a channel number with a vector index position
     std::vector<RegistryBase*> registries_; ///< Registries needed by this Module
+    std::vector<ChanNums> groups_;          ///< Channel groups updated together
+    uint64 generation_;                     ///< Incremented when channel numbers change
 
 };
 
@@ -30,6 +30,9 @@ public:
     /// Updates a single channel
     bool update_channel(ChanNum channel_number) override;
 
+    /// Updates multiple channels, checking the connector only once
+    bool update_channels(const ChanNums& channel_numbers) override;
+
 private:
 
     friend class MyRioConnector;
@@ -32,6 +32,9 @@ public:
     /// Updates a single channel
     bool update_channel(ChanNum channel_number) override;
 
+    /// Updates multiple channels, reading/writing each register bank once
+    bool update_channels(const ChanNums& channel_numbers) override;
+
     /// Sets the direction of a single channel
     bool set_direction(ChanNum channel_number, Direction direction) override;
 
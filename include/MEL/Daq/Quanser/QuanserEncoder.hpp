@@ -37,8 +37,6 @@ public:
 
     QuanserEncoder(QuanserDaq& daq, const ChanNums& channel_numbers, bool has_velocity);
 
-    bool update() override;
-
     bool update_channel(ChanNum channel_number) override;
 
     bool reset_counts(const std::vector<int32>& counts) override;
@@ -79,6 +77,11 @@ public:
     /// Returns multiple QuanserEncoder::Channels
     std::vector<Channel> operator[](const ChanNums& channel_numbers);
 
+protected:
+
+    /// Reads the counts (and velocities) of all channels in one call
+    bool update_all() override;
+
 private:
 
     QuanserDaq& daq_;                            ///< Reference to parent QDaq
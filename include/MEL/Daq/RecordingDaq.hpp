@@ -0,0 +1,138 @@
+// MIT License
+//
+// MEL - Mechatronics Engine & Library
+// Copyright (c) 2019 Mechatronics and Haptic Interfaces Lab - Rice University
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// Author(s): Evan Pezent (epezent@rice.edu)
+
+#pragma once
+
+#include <MEL/Daq/DaqBase.hpp>
+#include <MEL/Daq/Module.hpp>
+#include <MEL/Core/Clock.hpp>
+#include <MEL/Utility/RealtimeThread.hpp>
+#include <atomic>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace mel {
+
+//==============================================================================
+// CLASS DECLARATION
+//==============================================================================
+
+/// Wraps any DAQ and records the result of every update_input() to a binary file
+class RecordingDaq : public DaqBase {
+public:
+
+    /// Constructor. Any of the input Modules may be nullptr if the wrapped DAQ
+    /// does not have them. The wrapped DAQ must outlive this RecordingDaq.
+    RecordingDaq(const std::string& name,
+                 DaqBase& daq,
+                 const std::string& filepath,
+                 Module<Voltage>* ai,
+                 Module<Logic>* di,
+                 Module<int32>* encoder);
+
+    /// Destructor. Flushes and closes the recording.
+    ~RecordingDaq();
+
+    /// Updates the wrapped DAQ's inputs and appends a frame to the recording.
+    /// Returns false without recording if a Module's channel count changed
+    /// since open().
+    bool update_input() override;
+
+    /// Updates the wrapped DAQ's outputs
+    bool update_output() override;
+
+    /// Returns the number of frames recorded since open
+    std::size_t get_frame_count() const;
+
+protected:
+
+    /// Opens the wrapped DAQ (if needed) and the recording file
+    bool on_open() override;
+
+    /// Flushes and closes the recording file and closes the wrapped DAQ
+    bool on_close() override;
+
+    /// Enables the wrapped DAQ
+    bool on_enable() override;
+
+    /// Disables the wrapped DAQ
+    bool on_disable() override;
+
+private:
+
+    /// Hands a full frame buffer to the writer thread if it is idle
+    void hand_off();
+
+    /// Writes the handed off buffer to disk, if any (writer thread)
+    void write_pending();
+
+    /// Writes frames still held by the control loop to disk
+    void flush();
+
+private:
+
+    DaqBase& daq_;              ///< wrapped DAQ
+    std::string filepath_;      ///< recording filepath
+    Module<Voltage>* ai_;       ///< recorded AI Module
+    Module<Logic>* di_;         ///< recorded DI Module
+    Module<int32>* encoder_;    ///< recorded encoder Module
+    std::ofstream file_;        ///< recording file
+    std::vector<char> buffer_;  ///< frames being filled by update_input()
+    std::vector<char> pending_; ///< full frames owned by the writer thread
+    std::atomic<bool> pending_full_;  ///< does pending_ hold frames to write?
+    std::atomic<bool> writing_;       ///< should the writer thread run?
+    RealtimeThread writer_;     ///< writes handed off buffers to file_
+    std::size_t counts_[3];     ///< AI, DI, encoder channel counts at open
+    std::size_t frame_size_;    ///< bytes per frame
+    std::size_t frame_count_;   ///< frames recorded
+    Clock clock_;               ///< timestamps frames
+};
+
+}  // namespace mel
+
+//==============================================================================
+// CLASS DOCUMENTATION
+//==============================================================================
+
+/// \class mel::RecordingDaq
+/// \ingroup Daq
+///
+/// RecordingDaq forwards update_input()/update_output() to another DAQ and
+/// appends each input result (timestamp plus every AI, DI and encoder value)
+/// to a compact binary file. Frames are buffered in memory and written in
+/// large blocks, so the cost in the control loop is a few memcpys. Full
+/// buffers are swapped to a background writer thread; update_input() never
+/// touches the file. If the writer falls behind, the active buffer simply
+/// grows until the next swap. The file
+/// can be played back with ReplayDaq on a machine without the hardware.
+///
+/// Usage example:
+/// \code
+/// Q8Usb q8;
+/// RecordingDaq rec("rec", q8, "session.meldaq", &q8.AI, nullptr, &q8.encoder);
+/// rec.open();
+/// rec.enable();
+/// while (running) {
+///     rec.update_input();
+///     ...
+///     rec.update_output();
+/// }
+/// rec.close();
+/// \endcode
+///
+/// \see ReplayDaq
@@ -18,6 +18,7 @@
 #pragma once
 
 #include <MEL/Core/Types.hpp>
+#include <MEL/Daq/ChanMap.hpp>
 #include <iostream>
 #include <algorithm>
 
@@ -43,9 +44,14 @@ protected:
 
 protected:
 
-    ModuleBase* module_; ///< pointer to parent module
+    ModuleBase* module_;   ///< pointer to parent module
+    const ChanMap* map_;   ///< parent module's channel map
 };
 
+inline std::size_t RegistryBase::index(ChanNum channel_number) const {
+    return map_->at(channel_number);
+}
+
 //==============================================================================
 // CLASS DECLARATION
 //==============================================================================
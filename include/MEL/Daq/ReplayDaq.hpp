@@ -0,0 +1,199 @@
+// MIT License
+//
+// MEL - Mechatronics Engine & Library
+// Copyright (c) 2019 Mechatronics and Haptic Interfaces Lab - Rice University
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// Author(s): Evan Pezent (epezent@rice.edu)
+
+#pragma once
+
+#include <MEL/Daq/DaqBase.hpp>
+#include <MEL/Daq/Input.hpp>
+#include <MEL/Daq/Encoder.hpp>
+#include <MEL/Core/Clock.hpp>
+#include <string>
+#include <vector>
+
+namespace mel {
+
+class ReplayDaq;
+
+//==============================================================================
+// REPLAY AI
+//==============================================================================
+
+class ReplayAI : public AnalogInput {
+public:
+    ReplayAI(ReplayDaq& daq);
+    bool update_channel(ChanNum channel_number) override;
+    bool update_channels(const ChanNums& channel_numbers) override;
+    /// Copies the whole recorded AI block of the current frame
+    bool update() override;
+private:
+    ReplayDaq& daq_;
+};
+
+//==============================================================================
+// REPLAY DI
+//==============================================================================
+
+class ReplayDI : public DigitalInput {
+public:
+    ReplayDI(ReplayDaq& daq);
+    bool update_channel(ChanNum channel_number) override;
+    bool update_channels(const ChanNums& channel_numbers) override;
+private:
+    ReplayDaq& daq_;
+};
+
+//==============================================================================
+// REPLAY ENCODER
+//==============================================================================
+
+class ReplayEncoder : public Encoder {
+public:
+    ReplayEncoder(ReplayDaq& daq);
+    bool update_channel(ChanNum channel_number) override;
+    bool update_channels(const ChanNums& channel_numbers) override;
+    /// Copies the whole recorded encoder block of the current frame, then
+    /// estimates velocities at the recorded time
+    bool update() override;
+    bool reset_count(ChanNum channel_number, int count) override;
+private:
+    ReplayDaq& daq_;
+};
+
+//==============================================================================
+// REPLAY DAQ
+//==============================================================================
+
+/// Plays back a file written by RecordingDaq through AI, DI and encoder Modules
+class ReplayDaq : public DaqBase {
+public:
+
+    /// Playback pace
+    enum Pace {
+        Recorded,         ///< update_input() blocks until the frame's recorded time
+        AsFastAsPossible  ///< update_input() advances immediately
+    };
+
+public:
+
+    /// Constructor. Loads the recording and sets Module channel numbers.
+    ReplayDaq(const std::string& name, const std::string& filepath, Pace pace = AsFastAsPossible);
+
+    /// Destructor
+    ~ReplayDaq();
+
+    /// Advances to the next frame and updates all inputs. Returns false once
+    /// the recording is exhausted (unless looping), or if a Module's channel
+    /// count no longer matches the recording.
+    bool update_input() override;
+
+    /// Does nothing; outputs are not part of a recording
+    bool update_output() override;
+
+    /// Sets the playback pace
+    void set_pace(Pace pace);
+
+    /// Sets whether playback restarts from the first frame when exhausted
+    void set_looping(bool looping);
+
+    /// Restarts playback from the first frame
+    void rewind();
+
+    /// Returns true if the recording was loaded successfully
+    bool is_loaded() const;
+
+    /// Returns true if every frame has been played (and not looping)
+    bool is_finished() const;
+
+    /// Returns the number of frames in the recording
+    std::size_t get_frame_count() const;
+
+    /// Returns the recorded time of the current frame
+    Time get_time() const;
+
+public:
+
+    ReplayAI AI;
+    ReplayDI DI;
+    ReplayEncoder encoder;
+
+protected:
+
+    bool on_open() override;
+    bool on_close() override;
+    bool on_enable() override;
+    bool on_disable() override;
+
+private:
+
+    friend class ReplayAI;
+    friend class ReplayDI;
+    friend class ReplayEncoder;
+
+    /// Reads the whole recording into memory
+    bool load(const std::string& filepath);
+
+    /// Returns true if a Module still has as many channels as were recorded
+    /// for it; logs an error otherwise
+    bool check_channel_count(const ModuleBase& module, std::size_t recorded) const;
+
+    /// Returns the offset of a channel within its Module's block, or -1
+    static int find(const ChanNums& channel_numbers, ChanNum channel_number);
+
+private:
+
+    Pace pace_;                 ///< playback pace
+    bool looping_;              ///< restart when exhausted
+    bool loaded_;               ///< recording loaded
+    std::size_t n_ai_;          ///< recorded AI channels
+    std::size_t n_di_;          ///< recorded DI channels
+    std::size_t n_enc_;         ///< recorded encoder channels
+    std::size_t frame_size_;    ///< bytes per frame
+    std::size_t frame_count_;   ///< frames in recording
+    std::size_t frame_;         ///< index of the next frame to play
+    std::vector<char> data_;    ///< all frames
+    const char* current_;       ///< current frame, or nullptr before the first
+    Clock clock_;               ///< paces Recorded playback
+    Time start_time_;           ///< recorded time of the first frame played
+};
+
+}  // namespace mel
+
+//==============================================================================
+// CLASS DOCUMENTATION
+//==============================================================================
+
+/// \class mel::ReplayDaq
+/// \ingroup Daq
+///
+/// ReplayDaq loads a recording made by RecordingDaq into memory and exposes
+/// it through the same AI, DI and encoder Module interfaces as a hardware
+/// DAQ. Each update_input() steps one frame. In Recorded pace playback
+/// sleeps to reproduce the original timing; AsFastAsPossible plays frames
+/// back-to-back for deterministic offline benchmarks.
+///
+/// Usage example:
+/// \code
+/// ReplayDaq daq("replay", "session.meldaq");
+/// daq.open();
+/// daq.enable();
+/// while (daq.update_input()) {
+///     double x = daq.encoder[0].get_position();
+///     ...
+/// }
+/// \endcode
+///
+/// \see RecordingDaq
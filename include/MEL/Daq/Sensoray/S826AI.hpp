@@ -28,8 +28,8 @@ class S826;
 class S826AI : public AnalogInput, NonCopyable {
 public:
 
-    bool update() override;
     bool update_channel(ChanNum channel_number) override;
+    bool update_channels(const ChanNums& channel_numbers) override;
 
     /// Sets the amount of time to allow each analog input to settle before conversion (default = 5 us)
     bool set_settling_time(Time t);
@@ -30,6 +30,7 @@ public:
     class Channel;
 
     bool update_channel(ChanNum channel_number) override;
+    bool update_channels(const ChanNums& channel_numbers) override;
     bool reset_count(ChanNum channel_number, int32 count) override;
     bool set_quadrature_factor(ChanNum channel_number, QuadFactor factor) override;
 
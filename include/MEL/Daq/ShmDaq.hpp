@@ -0,0 +1,257 @@
+// MIT License
+//
+// MEL - Mechatronics Engine & Library
+// Copyright (c) 2019 Mechatronics and Haptic Interfaces Lab - Rice University
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// Author(s): Evan Pezent (epezent@rice.edu)
+
+#pragma once
+
+#include <MEL/Daq/DaqBase.hpp>
+#include <MEL/Daq/Input.hpp>
+#include <MEL/Daq/Output.hpp>
+#include <MEL/Daq/Encoder.hpp>
+#include <MEL/Core/Clock.hpp>
+#include <memory>
+#include <string>
+
+namespace mel {
+
+class ShmDaq;
+class SharedMemory;
+struct ShmDaqSegment;
+
+//==============================================================================
+// SHM MODULES
+//==============================================================================
+
+class ShmAI : public AnalogInput {
+public:
+    ShmAI(ShmDaq& daq);
+    bool update_channel(ChanNum channel_number) override;
+    bool update_channels(const ChanNums& channel_numbers) override;
+private:
+    ShmDaq& daq_;
+};
+
+class ShmDI : public DigitalInput {
+public:
+    ShmDI(ShmDaq& daq);
+    bool update_channel(ChanNum channel_number) override;
+    bool update_channels(const ChanNums& channel_numbers) override;
+private:
+    ShmDaq& daq_;
+};
+
+class ShmEncoder : public Encoder {
+public:
+    ShmEncoder(ShmDaq& daq);
+    bool update_channel(ChanNum channel_number) override;
+    bool update_channels(const ChanNums& channel_numbers) override;
+    bool reset_count(ChanNum channel_number, int count) override;
+private:
+    ShmDaq& daq_;
+};
+
+class ShmAO : public AnalogOutput {
+public:
+    ShmAO(ShmDaq& daq);
+    bool update_channel(ChanNum channel_number) override;
+    bool update_channels(const ChanNums& channel_numbers) override;
+private:
+    ShmDaq& daq_;
+};
+
+class ShmDO : public DigitalOutput {
+public:
+    ShmDO(ShmDaq& daq);
+    bool update_channel(ChanNum channel_number) override;
+    bool update_channels(const ChanNums& channel_numbers) override;
+private:
+    ShmDaq& daq_;
+};
+
+//==============================================================================
+// SHM DAQ SERVER
+//==============================================================================
+
+/// Wraps the DAQ that owns the hardware and mirrors its Modules into shared memory
+class ShmDaqServer : public DaqBase {
+public:
+    /// Constructor. Any Module may be nullptr if the wrapped DAQ does not have
+    /// it. Each Module may have at most 64 channels. The wrapped DAQ must
+    /// outlive this ShmDaqServer.
+    ShmDaqServer(const std::string& name,
+                 DaqBase& daq,
+                 const std::string& segment,
+                 Module<Voltage>* ai,
+                 Module<Logic>* di,
+                 Module<int32>* encoder,
+                 Module<Voltage>* ao,
+                 Module<Logic>* dout);
+
+    /// Destructor
+    ~ShmDaqServer();
+
+    /// Updates the wrapped DAQ's inputs and publishes them to shared memory
+    bool update_input() override;
+
+    /// Copies the latest client command (if any) into the wrapped AO and DO,
+    /// then updates the wrapped DAQ's outputs. Never waits for a client.
+    bool update_output() override;
+
+    /// Returns the number of client commands applied by update_output()
+    uint64 get_output_commands() const;
+
+protected:
+
+    /// Opens the wrapped DAQ (if needed) and creates the shared memory segment
+    bool on_open() override;
+
+    /// Releases the shared memory segment and closes the wrapped DAQ
+    bool on_close() override;
+
+    /// Enables the wrapped DAQ
+    bool on_enable() override;
+
+    /// Disables the wrapped DAQ
+    bool on_disable() override;
+
+private:
+
+    DaqBase& daq_;                       ///< wrapped DAQ
+    std::string segment_;                ///< shared memory name
+    Module<Voltage>* ai_;                ///< mirrored AI Module
+    Module<Logic>* di_;                  ///< mirrored DI Module
+    Module<int32>* encoder_;             ///< mirrored encoder Module
+    Module<Voltage>* ao_;                ///< commanded AO Module
+    Module<Logic>* dout_;                ///< commanded DO Module
+    std::unique_ptr<SharedMemory> shm_;  ///< shared memory segment
+    ShmDaqSegment* seg_;                 ///< mapped segment
+    uint32 output_seq_;                  ///< sequence of the last applied command
+    uint64 output_commands_;             ///< client commands applied
+    uint32 stuck_seq_;                   ///< odd command sequence seen by the last poll
+    int stuck_polls_;                    ///< consecutive polls that saw stuck_seq_
+    Clock clock_;                        ///< timestamps inputs
+};
+
+//==============================================================================
+// SHM DAQ
+//==============================================================================
+
+/// DAQ whose Modules read and write a segment published by a ShmDaqServer
+class ShmDaq : public DaqBase {
+public:
+    /// Constructor. Channel numbers are taken from the server on open().
+    ShmDaq(const std::string& name, const std::string& segment);
+
+    /// Destructor
+    ~ShmDaq();
+
+    /// Copies the latest published inputs into AI, DI and encoder. Never blocks
+    /// for longer than the server takes to copy one snapshot.
+    bool update_input() override;
+
+    /// Publishes the AO and DO values as the latest command to the server
+    bool update_output() override;
+
+    /// Gets the time the current inputs were read by the server, since it opened
+    Time get_input_timestamp() const;
+
+    /// Returns the number of update_input() calls that found no new inputs
+    uint64 get_stale_inputs() const;
+
+protected:
+
+    /// Opens the server's shared memory segment and adopts its channel numbers
+    bool on_open() override;
+
+    /// Releases the shared memory segment
+    bool on_close() override;
+
+    /// Enables the input Modules. AO and DO are enabled by the user, since
+    /// enabling an Output writes its enable values to the server.
+    bool on_enable() override;
+
+    /// Disables all enabled Modules
+    bool on_disable() override;
+
+public:
+
+    ShmAI AI;            ///< mirrored AI Module
+    ShmDI DI;            ///< mirrored DI Module
+    ShmEncoder encoder;  ///< mirrored encoder Module
+    ShmAO AO;            ///< commanded AO Module
+    ShmDO DO;            ///< commanded DO Module
+
+private:
+
+    std::string segment_;                ///< shared memory name
+    std::unique_ptr<SharedMemory> shm_;  ///< shared memory segment
+    ShmDaqSegment* seg_;                 ///< mapped segment
+    uint32 input_seq_;                   ///< sequence of the current inputs
+    Time input_timestamp_;               ///< server time of the current inputs
+    uint64 stale_inputs_;                ///< update_input() calls without new inputs
+    bool command_blocked_;               ///< did the last update_output() fail to acquire?
+};
+
+}  // namespace mel
+
+//==============================================================================
+// CLASS DOCUMENTATION
+//==============================================================================
+
+/// \class mel::ShmDaqServer
+/// \ingroup Daq
+///
+/// ShmDaqServer and ShmDaq let several processes share one DAQ. The process
+/// that owns the hardware wraps its DAQ in a ShmDaqServer. Each
+/// update_input() then copies every AI, DI and encoder value into a
+/// fixed-layout shared memory segment. Planner, GUI or logger processes
+/// open a ShmDaq on the same segment name. Its AI, DI and encoder Modules
+/// read that segment, and its AO and DO Modules write a command block that
+/// the server applies on its next update_output().
+///
+/// Both blocks are seqlocks: a writer makes the sequence number odd, copies
+/// its values and makes it even again, and readers retry if the number
+/// changed during their copy. The cost per update is a memcpy of a few
+/// hundred bytes. Several clients may command outputs; the last complete
+/// command wins. The server never waits on the command block: if a client
+/// is mid-write, update_output() applies the command on a later update. If
+/// a client dies mid-write, the server reclaims the block once the same
+/// write has been open for 1000 consecutive updates, and clients can
+/// command again.
+///
+/// \code
+/// // hardware process
+/// Q8Usb q8;
+/// ShmDaqServer server("server", q8, "q8", &q8.AI, nullptr, &q8.encoder, &q8.AO, nullptr);
+/// server.open();
+/// server.enable();
+/// while (running) {
+///     server.update_input();
+///     server.update_output();
+///     timer.wait();
+/// }
+///
+/// // client process
+/// ShmDaq daq("client", "q8");
+/// daq.open();
+/// daq.enable();
+/// daq.AO.enable();  // only in the process that commands outputs
+/// daq.update_input();
+/// daq.AO.set_value(0, daq.AI.get_value(0));
+/// daq.update_output();
+/// \endcode
+///
+/// \see SharedMemory, AsyncDaq
@@ -0,0 +1,150 @@
+// MIT License
+//
+// MEL - Mechatronics Engine & Library
+// Copyright (c) 2019 Mechatronics and Haptic Interfaces Lab - Rice University
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// Author(s): Evan Pezent (epezent@rice.edu)
+
+#pragma once
+
+#include <MEL/Daq/Watchdog.hpp>
+#include <MEL/Core/Clock.hpp>
+#include <MEL/Utility/RealtimeThread.hpp>
+#include <atomic>
+#include <functional>
+
+namespace mel {
+
+//==============================================================================
+// CLASS DECLARATION
+//==============================================================================
+
+/// Watchdog timer monitored by a dedicated high-priority thread
+class SoftwareWatchdog : public Watchdog {
+public:
+    /// Called on the watchdog thread when the watchdog expires
+    typedef std::function<void()> Callback;
+
+public:
+    /// Constructor. The watchdog thread checks the time since the last kick
+    /// every poll_period (timeout / 10 if zero) with the given RealtimeThread
+    /// priority (0 leaves the OS default).
+    SoftwareWatchdog(Time timeout,
+                     Callback on_expire = Callback(),
+                     int priority = 90,
+                     Time poll_period = Time::Zero);
+
+    /// Destructor. Stops the watchdog thread if it is running.
+    ~SoftwareWatchdog();
+
+    /// Launches the watchdog thread and counts the timeout from now
+    bool start() override;
+
+    /// Reloads the timer with a single atomic store. Starts the watchdog if
+    /// it hasn't been started. Returns false if the watchdog has expired.
+    bool kick() override;
+
+    /// Stops the watchdog thread
+    bool stop() override;
+
+    /// Returns true if the watchdog has expired and not been cleared
+    bool is_expired() override;
+
+    /// Clears the expired state and counts the timeout from now
+    bool clear() override;
+
+    /// Sets the timeout period. Takes effect on the next poll. If no poll
+    /// period was given to the constructor, it becomes timeout / 10 after
+    /// the poll already in progress, so shortening the timeout while running
+    /// can delay the first expiry by up to one previous poll period.
+    void set_timeout(Time timeout) override;
+
+    /// Sets the safe-state callback invoked on expiry. Call while stopped.
+    void set_expire_callback(Callback on_expire);
+
+    /// Gets the closest approach to expiry observed while kicks were on time,
+    /// i.e. the timeout minus the longest time seen between kicks. Resolution
+    /// is the poll period.
+    Time get_min_margin() const;
+
+    /// Gets the longest time seen between kicks (resolution is the poll period)
+    Time get_max_kick_interval() const;
+
+    /// Gets the number of times the watchdog has expired
+    uint64 get_expirations() const;
+
+    /// Resets the margin and expiration statistics
+    void reset_stats();
+
+private:
+    /// Watchdog thread loop
+    void watch();
+
+    /// Checks the time since the last kick and expires the watchdog if needed
+    void poll();
+
+private:
+    Callback on_expire_;                   ///< safe-state callback
+    std::atomic<int64> poll_ns_;           ///< how often the watchdog thread checks
+    bool auto_poll_;                       ///< poll period follows the timeout?
+    RealtimeThread thread_;                ///< watchdog thread
+    Clock clock_;                          ///< time base for kicks
+    std::atomic<bool> running_;            ///< watchdog thread run flag
+    std::atomic<bool> expired_;            ///< set by the watchdog thread on expiry
+    std::atomic<int64> timeout_ns_;        ///< timeout shared with the watchdog thread
+    std::atomic<int64> last_kick_ns_;      ///< written by kick(), read by the watchdog thread
+    std::atomic<int64> max_interval_ns_;   ///< written by the watchdog thread
+    std::atomic<uint64> expirations_;      ///< written by the watchdog thread
+};
+
+}  // namespace mel
+
+//==============================================================================
+// CLASS DOCUMENTATION
+//==============================================================================
+
+/// \class mel::SoftwareWatchdog
+/// \ingroup Daq
+///
+/// mel::SoftwareWatchdog provides stall protection where no hardware watchdog
+/// exists, e.g. with a VirtualDaq or a Linux-only setup. kick() stores the
+/// current time in an atomic and nothing else, so it is safe to call from a
+/// real-time loop. A separate RealtimeThread wakes every poll period, and if
+/// more than the timeout has passed since the last kick it marks the
+/// watchdog expired and invokes the safe-state callback once. The callback
+/// runs on the watchdog thread while the control loop may still be stalled
+/// inside a DAQ call, so it should only touch state that is safe to access
+/// from there (e.g. an Output module's values followed by update()).
+///
+/// The watchdog also records how close it came to expiring. The longest
+/// interval between kicks and the resulting minimum margin (timeout minus
+/// that interval) are measured at the poll resolution and can be used to
+/// size the timeout from real runs.
+///
+/// \code
+/// VirtualDaq daq("rig");
+/// SoftwareWatchdog watchdog(milliseconds(10), [&]() {
+///     daq.AO.set_values(std::vector<Voltage>(daq.AO.get_channel_count(), 0.0));
+///     daq.AO.update();
+/// });
+/// watchdog.start();
+/// while (running) {
+///     ...
+///     watchdog.kick();
+///     timer.wait();
+/// }
+/// watchdog.stop();
+/// print(watchdog.get_min_margin());
+/// \endcode
+///
+/// \see Watchdog, RealtimeThread
@@ -0,0 +1,144 @@
+// MIT License
+//
+// MEL - Mechatronics Engine & Library
+// Copyright (c) 2019 Mechatronics and Haptic Interfaces Lab - Rice University
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// Author(s): Evan Pezent (epezent@rice.edu)
+
+#pragma once
+
+#include <MEL/Daq/Module.hpp>
+#include <type_traits>
+#include <utility>
+
+namespace mel {
+
+namespace detail {
+
+/// Index of channel number Ch in a channel number pack (pack size if absent)
+template <ChanNum Ch, ChanNum... Channels>
+struct StaticIndex;
+
+template <ChanNum Ch>
+struct StaticIndex<Ch> {
+    static constexpr std::size_t value = 0;
+};
+
+template <ChanNum Ch, ChanNum First, ChanNum... Rest>
+struct StaticIndex<Ch, First, Rest...> {
+    static constexpr std::size_t value = Ch == First ? 0 : 1 + StaticIndex<Ch, Rest...>::value;
+};
+
+/// True if a channel number pack is strictly increasing
+template <ChanNum... Channels>
+struct StaticSorted : std::true_type { };
+
+template <ChanNum First, ChanNum Second, ChanNum... Rest>
+struct StaticSorted<First, Second, Rest...>
+    : std::integral_constant<bool, (First < Second) && StaticSorted<Second, Rest...>::value> { };
+
+/// Logs a warning that a StaticModule ignored a request to change its
+/// channel numbers
+void warn_static_channel_numbers(const ModuleBase& module, const char* function);
+
+}  // namespace detail
+
+//==============================================================================
+// CLASS DECLARATION
+//==============================================================================
+
+/// A Module whose channel numbers are fixed at compile time
+template <class Base, ChanNum... Channels>
+class StaticModule final : public Base {
+public:
+
+    /// The value type of the underlying Module
+    typedef typename std::decay<decltype(std::declval<Base&>().get_values()[0])>::type Value;
+
+    static_assert(std::is_base_of<ModuleBase, Base>::value, "StaticModule Base must be a Module");
+    static_assert(sizeof...(Channels) > 0, "StaticModule requires at least one channel number");
+    static_assert(detail::StaticSorted<Channels...>::value, "StaticModule channel numbers must be unique and increasing");
+
+    /// Constructs Base from args, then fixes its channel numbers to Channels
+    template <typename... Args>
+    explicit StaticModule(Args&&... args);
+
+    /// Number of channels, known at compile time
+    static constexpr std::size_t size();
+
+    /// Index of channel number Ch into the Module's values, resolved at compile time
+    template <ChanNum Ch>
+    static constexpr std::size_t index();
+
+    /// Gets the value of channel Ch
+    template <ChanNum Ch>
+    Value get() const;
+
+    /// Sets the value of channel Ch
+    template <ChanNum Ch>
+    void set(Value value);
+
+    using Base::update_channel;
+
+    /// Updates channel Ch (statically dispatched since StaticModule is final)
+    template <ChanNum Ch>
+    bool update_channel();
+
+    /// Channel numbers are fixed; this logs a warning and does nothing
+    void set_channel_numbers(const ChanNums& channel_numbers) override;
+
+    /// Channel numbers are fixed; this logs a warning and does nothing
+    void add_channel_number(ChanNum channel_number) override;
+
+    /// Channel numbers are fixed; this logs a warning and does nothing
+    void remove_channel_number(ChanNum channel_number) override;
+
+private:
+
+    template <ChanNum Ch>
+    struct Contains : std::integral_constant<bool,
+        detail::StaticIndex<Ch, Channels...>::value < sizeof...(Channels)> { };
+};
+
+}  // namespace mel
+
+#include <MEL/Daq/Detail/StaticModule.inl>
+
+//==============================================================================
+// CLASS DOCUMENTATION
+//==============================================================================
+
+/// \class mel::StaticModule
+/// \ingroup Daq
+///
+/// mel::StaticModule wraps a Module type (an interface such as AnalogInput,
+/// or a concrete backend such as VirtualAI) and pins its channel numbers to
+/// the template parameters. Because the channel set can never change, the
+/// index of a channel is a compile-time constant and get<Ch>()/set<Ch>()
+/// compile down to a single array access, with no ChanMap lookup or channel
+/// validation. Channel numbers not on the Module are rejected at compile
+/// time. The class is final, so calls to update() and update_channel() on
+/// a StaticModule object are dispatched statically.
+///
+/// Everything else is inherited from Base: Channel handles, Joints and
+/// sensors built on them, groups, and streaming work unchanged.
+///
+/// \code
+/// VirtualDaq daq("rig");
+/// StaticModule<VirtualAI, 0, 1, 2, 3> ai(daq, ChanNums());
+/// ai.update();
+/// Voltage v = ai.get<2>();
+/// // ai.get<7>();  // compile error: channel 7 is not on this Module
+/// \endcode
+///
+/// \see Module, ChanMap
@@ -21,6 +21,7 @@
 #include <MEL/Daq/Output.hpp>
 #include <MEL/Daq/InputOutput.hpp>
 #include <MEL/Daq/Encoder.hpp>
+#include <MEL/Daq/VirtualPlant.hpp>
 #include <MEL/Core/Clock.hpp>
 #include <functional>
 
@@ -33,13 +34,39 @@ class VirtualDaq;
 //==============================================================================
 
 class VirtualAI : public AnalogInput {
+public:
+    /// Fills the values of all channels, in channel number order, at Time t.
+    /// The vector is pre-sized to the channel count and must not be resized.
+    typedef std::function<void(Time, std::vector<Voltage>&)> VectorSource;
 public:
     VirtualAI(VirtualDaq& daq, const ChanNums& channel_numbers);
     bool update_channel(ChanNum channel_number) override;
+    bool update_channels(const ChanNums& channel_numbers) override;
+    /// Samples every channel, writing vector source output in place
+    bool update() override;
+    /// Sets a vectorized source that overrides the per-channel sources
+    void set_vector_source(VectorSource source);
+    /// Removes the vectorized source, restoring the per-channel sources
+    void clear_vector_source();
 public:
     Registry<std::function<Voltage(Time)>> sources;
+protected:
+    bool on_start_stream(Frequency sample_rate) override;
+    void on_read_stream() override;
+private:
+    friend class VirtualDaq;
+    /// Samples the sources of the given channels, or all channels if
+    /// channel_numbers is nullptr, at Time t
+    bool sample(Time t, const ChanNums* channel_numbers = nullptr);
+    /// Evaluates every channel's source at Time t into scan, in channel order
+    void evaluate_scan(Time t, std::vector<Voltage>& scan);
 private:
     VirtualDaq& daq_;
+    VectorSource vector_source_;
+    Registry<Voltage> buffer_;
+    Time stream_start_;           ///< DAQ time of the first stream scan
+    uint64 stream_scans_;         ///< scans produced since start_stream()
+    std::vector<Voltage> scan_;   ///< scratch scan
 };
 
 //==============================================================================
@@ -50,6 +77,7 @@ class VirtualAO : public AnalogOutput {
 public:
     VirtualAO(VirtualDaq& daq, const ChanNums& channel_numbers);
     bool update_channel(ChanNum channel_number) override;
+    bool update_channels(const ChanNums& channel_numbers) override;
 private:
     VirtualDaq& daq_;
 };
@@ -59,13 +87,31 @@ private:
 //==============================================================================
 
 class VirtualDI : public DigitalInput {
+public:
+    /// Fills the values of all channels, in channel number order, at Time t.
+    /// The vector is pre-sized to the channel count and must not be resized.
+    typedef std::function<void(Time, std::vector<Logic>&)> VectorSource;
 public:
     VirtualDI(VirtualDaq& daq, const ChanNums& channel_numbers);
     bool update_channel(ChanNum channel_number) override;
+    bool update_channels(const ChanNums& channel_numbers) override;
+    /// Samples every channel, writing vector source output in place
+    bool update() override;
+    /// Sets a vectorized source that overrides the per-channel sources
+    void set_vector_source(VectorSource source);
+    /// Removes the vectorized source, restoring the per-channel sources
+    void clear_vector_source();
 public:
     Registry<std::function<Logic(Time)>> sources;
+private:
+    friend class VirtualDaq;
+    /// Samples the sources of the given channels, or all channels if
+    /// channel_numbers is nullptr, at Time t
+    bool sample(Time t, const ChanNums* channel_numbers = nullptr);
 private:
     VirtualDaq& daq_;
+    VectorSource vector_source_;
+    Registry<Logic> buffer_;
 };
 
 //==============================================================================
@@ -76,6 +122,7 @@ class VirtualDO : public DigitalOutput {
 public:
     VirtualDO(VirtualDaq& daq, const ChanNums& channel_numbers);
     bool update_channel(ChanNum channel_number) override;
+    bool update_channels(const ChanNums& channel_numbers) override;
 private:
     VirtualDaq& daq_;
 };
@@ -85,14 +132,33 @@ private:
 //==============================================================================
 
 class VirtualEncoder : public Encoder {
+public:
+    /// Fills the values of all channels, in channel number order, at Time t.
+    /// The vector is pre-sized to the channel count and must not be resized.
+    typedef std::function<void(Time, std::vector<int32>&)> VectorSource;
 public:
     VirtualEncoder(VirtualDaq& daq, const ChanNums& channel_numbers);
     bool update_channel(ChanNum channel_number) override;
+    bool update_channels(const ChanNums& channel_numbers) override;
+    /// Samples every channel, writing vector source output in place, then
+    /// estimates velocities
+    bool update() override;
     bool reset_count(ChanNum channel_number, int count);
+    /// Sets a vectorized source that overrides the per-channel sources
+    void set_vector_source(VectorSource source);
+    /// Removes the vectorized source, restoring the per-channel sources
+    void clear_vector_source();
 public:
     Registry<std::function<int32(Time)>> sources;
+private:
+    friend class VirtualDaq;
+    /// Samples the sources of the given channels, or all channels if
+    /// channel_numbers is nullptr, at Time t
+    bool sample(Time t, const ChanNums* channel_numbers = nullptr);
 private:
     VirtualDaq& daq_;
+    VectorSource vector_source_;
+    Registry<int32> buffer_;
 };
 
 //==============================================================================
@@ -107,6 +173,15 @@ public:
 
     bool update_input() override;
     bool update_output() override;
+
+    /// Enables closed-loop mode. Each update_output() advances the plant and
+    /// simulated time by step, and each update_input() reads the plant's
+    /// measurements in place of the sources. Pass nullptr to return to open
+    /// loop. The plant is not owned and must outlive this VirtualDaq.
+    void set_plant(VirtualPlant* plant, Time step = milliseconds(1));
+
+    /// Gets the time seen by sources and plants (simulated in closed-loop mode)
+    Time get_time() const;
 public:
     VirtualAI AI;
     VirtualAO AO;
@@ -126,7 +201,19 @@ protected:
     friend class VirtualDI;
     friend class VirtualDO;
     friend class VirtualEncoder;
+
+    /// Writes the plant's measurements into the scratch vectors below, so
+    /// that a single Module can take its own channels without clobbering
+    /// the values of the others
+    void measure_plant();
+
     Clock clock_;
+    VirtualPlant* plant_;                ///< closed-loop plant, or nullptr
+    Time step_;                          ///< simulated time per update_output()
+    Time sim_time_;                      ///< simulated time
+    std::vector<Voltage> plant_ai_;      ///< scratch AI measurements
+    std::vector<Logic> plant_di_;        ///< scratch DI measurements
+    std::vector<int32> plant_encoder_;   ///< scratch encoder measurements
 };
 
 }
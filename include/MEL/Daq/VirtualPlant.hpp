@@ -0,0 +1,129 @@
+// MIT License
+//
+// MEL - Mechatronics Engine & Library
+// Copyright (c) 2019 Mechatronics and Haptic Interfaces Lab - Rice University
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// Author(s): Evan Pezent (epezent@rice.edu)
+
+#pragma once
+
+#include <MEL/Core/Time.hpp>
+#include <MEL/Core/Types.hpp>
+#include <vector>
+
+namespace mel {
+
+//==============================================================================
+// CLASS DECLARATION
+//==============================================================================
+
+/// Discrete-time plant model driven by a VirtualDaq in closed-loop mode
+class VirtualPlant {
+public:
+    /// Destructor
+    virtual ~VirtualPlant() { }
+
+    /// Advances the plant by dt given the AO and DO values written by the
+    /// controller. Values are in each Module's channel number order.
+    virtual void step(Time dt,
+                      const std::vector<Voltage>& ao,
+                      const std::vector<Logic>& dout) = 0;
+
+    /// Writes the plant's current measurements into the AI, DI, and encoder
+    /// values. Values are in each Module's channel number order.
+    virtual void measure(std::vector<Voltage>& ai,
+                         std::vector<Logic>& di,
+                         std::vector<int32>& encoder) = 0;
+};
+
+//==============================================================================
+// CLASS DECLARATION
+//==============================================================================
+
+/// Discrete-time linear state-space plant
+class LinearPlant : public VirtualPlant {
+public:
+    /// Row-major dense matrix
+    typedef std::vector<std::vector<double>> Matrix;
+
+    /// Constructs the plant x[k+1] = A x[k] + B u[k], y[k] = C x[k] + D u[k].
+    /// u is filled from the AO values, and y is written to the AI values
+    /// followed by the encoder counts (rounded). D may be empty.
+    LinearPlant(const Matrix& A,
+                const Matrix& B,
+                const Matrix& C,
+                const Matrix& D = Matrix());
+
+    /// Advances the state by one sample. dt and the DO values are unused
+    /// because A and B are already discretized and u comes from AO only;
+    /// they are part of the VirtualPlant interface for time-aware plants.
+    void step(Time dt,
+              const std::vector<Voltage>& ao,
+              const std::vector<Logic>& dout) override;
+
+    /// Writes y = C x + D u into the AI values followed by the encoder counts
+    void measure(std::vector<Voltage>& ai,
+                 std::vector<Logic>& di,
+                 std::vector<int32>& encoder) override;
+
+    /// Sets the state vector
+    bool set_state(const std::vector<double>& x);
+
+    /// Gets the state vector
+    const std::vector<double>& get_state() const;
+
+private:
+
+    /// Flattens M into row-major storage, returns false if rows differ in size
+    static bool flatten(const Matrix& M, std::size_t rows, std::size_t cols, std::vector<double>& out);
+
+private:
+
+    std::size_t nx_, nu_, ny_;  ///< state, input, and output dimensions
+    std::vector<double> A_;     ///< nx x nx
+    std::vector<double> B_;     ///< nx x nu
+    std::vector<double> C_;     ///< ny x nx
+    std::vector<double> D_;     ///< ny x nu (all zero if not given)
+    std::vector<double> x_;     ///< state
+    std::vector<double> u_;     ///< last input
+    std::vector<double> xn_;    ///< next state scratch
+};
+
+}  // namespace mel
+
+//==============================================================================
+// CLASS DOCUMENTATION
+//==============================================================================
+
+/// \class mel::VirtualPlant
+/// \ingroup Daq
+///
+/// VirtualPlant closes the loop inside a VirtualDaq. Once installed with
+/// VirtualDaq::set_plant(), every update_output() hands the AO/DO values to
+/// step() and advances simulated time by a fixed step, and every
+/// update_input() fills the AI/DI/encoder values from measure(). Because time
+/// is simulated, a controller can run far faster than real time simply by not
+/// waiting on a Timer.
+///
+/// Usage example:
+/// \code
+/// // double integrator driven by AO[0], velocity measured on AI[0] and
+/// // position (1000 counts per unit) on encoder[0]
+/// double dt = 0.0001;
+/// LinearPlant plant({{1, dt}, {0, 1}}, {{0}, {dt}}, {{0, 1}, {1000, 0}});
+/// VirtualDaq daq("sim");
+/// daq.AI.set_channel_numbers({0});  // outputs fill AI first, then encoders
+/// daq.set_plant(&plant, seconds(dt));
+/// \endcode
+///
+/// \see VirtualDaq
@@ -23,4 +23,6 @@
 #include <MEL/Math/Functions.hpp>
 #include <MEL/Math/Integrator.hpp>
 #include <MEL/Math/Process.hpp>
+#include <MEL/Math/Trajectory.hpp>
 #include <MEL/Math/Waveform.hpp>
+#include <MEL/Math/WaveformBank.hpp>
@@ -0,0 +1,167 @@
+// MIT License
+//
+// MEL - Mechatronics Engine & Library
+// Copyright (c) 2019 Mechatronics and Haptic Interfaces Lab - Rice University
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// Author(s): Evan Pezent (epezent@rice.edu)
+
+#pragma once
+
+#include <MEL/Core/Time.hpp>
+#include <atomic>
+#include <vector>
+
+namespace mel {
+
+//==============================================================================
+// CLASS DECLARATION
+//==============================================================================
+
+/// Multi-joint trajectory of precomputed polynomial segments
+class Trajectory {
+public:
+    /// Constructs a trajectory for dof joints at rest at zero, able to queue
+    /// up to capacity - 1 segments ahead of the one being followed
+    Trajectory(std::size_t dof, std::size_t capacity = 64);
+
+    /// Returns the number of joints
+    std::size_t size() const;
+
+    /// Discards all segments and holds position at rest. Not thread safe;
+    /// call while neither planning nor update() is running.
+    void reset(const std::vector<double>& position);
+
+    //==========================================================================
+    // Planning (one producer thread, may run concurrently with update())
+    //==========================================================================
+
+    /// Queues a minimum-jerk move to goal over duration, starting from the
+    /// end state of the last queued segment
+    bool add_minimum_jerk(const std::vector<double>& goal, Time duration);
+
+    /// Queues a time-synchronized trapezoidal velocity move to goal. Every
+    /// joint finishes when the slowest one does, and none exceeds its maximum
+    /// velocity or acceleration. The last queued segment must end at rest.
+    bool add_trapezoidal(const std::vector<double>& goal,
+                         const std::vector<double>& max_velocity,
+                         const std::vector<double>& max_acceleration);
+
+    /// Queues a quintic spline through waypoints, reaching waypoint i at
+    /// times[i] after the end of the last queued segment. Velocity and
+    /// acceleration are continuous, and the spline ends at rest.
+    bool add_spline(const std::vector<std::vector<double>>& waypoints,
+                    const std::vector<Time>& times);
+
+    /// Gets the position at the end of the last queued segment
+    const std::vector<double>& get_planned_end() const;
+
+    //==========================================================================
+    // Evaluation (one consumer thread, e.g. the control loop)
+    //==========================================================================
+
+    /// Advances to Time t and evaluates all joints, returning positions. A
+    /// segment that arrives while idle starts at t; queued segments follow
+    /// each other back to back. Never blocks or allocates.
+    const std::vector<double>& update(Time t);
+
+    /// Gets the positions evaluated by the last update()
+    const std::vector<double>& get_positions() const;
+
+    /// Gets the velocities evaluated by the last update()
+    const std::vector<double>& get_velocities() const;
+
+    /// Gets the accelerations evaluated by the last update()
+    const std::vector<double>& get_accelerations() const;
+
+    /// Returns true if no segment is active or queued
+    bool is_done() const;
+
+private:
+    /// One joint's motion over a segment: up to three polynomial phases in
+    /// segment time, q(s) = c0 + c1 s + ... + c5 s^5 with s measured from
+    /// the phase start
+    struct Piece {
+        double start[3];  ///< phase start times [s]
+        double c[3][6];   ///< phase coefficients
+    };
+
+    /// Writes a quintic from (q0, v0, a0) to (q1, v1, a1) over T into phase 0
+    static void quintic(Piece& piece, double q0, double v0, double a0,
+                        double q1, double v1, double a1, double T);
+
+    /// Returns the slot the producer may write next, or false if full
+    bool reserve(std::size_t count, std::size_t& slot) const;
+
+    /// Publishes count slots written from slot onward
+    void publish(std::size_t count);
+
+    /// Evaluates the active segment at segment time tau into the outputs
+    void evaluate(std::size_t slot, double tau);
+
+private:
+    std::size_t dof_;                  ///< number of joints
+    std::size_t capacity_;             ///< number of segment slots
+    std::vector<double> durations_;    ///< segment durations [s]
+    std::vector<Piece> pieces_;        ///< capacity x dof pieces, slot-major
+    std::atomic<std::size_t> head_;    ///< next slot the producer writes
+    std::atomic<std::size_t> tail_;    ///< slot the consumer is following
+
+    std::vector<double> end_q_;        ///< planned end position (producer)
+    std::vector<double> end_v_;        ///< planned end velocity (producer)
+    std::vector<double> end_a_;        ///< planned end acceleration (producer)
+
+    bool active_;                      ///< following the tail slot (consumer)
+    double segment_start_;             ///< start time of the tail slot [s]
+    std::vector<double> q_;            ///< evaluated positions
+    std::vector<double> qd_;           ///< evaluated velocities
+    std::vector<double> qdd_;          ///< evaluated accelerations
+};
+
+}  // namespace mel
+
+//==============================================================================
+// CLASS DOCUMENTATION
+//==============================================================================
+
+/// \class mel::Trajectory
+/// \ingroup Math
+///
+/// mel::Trajectory replaces per-tick reference synthesis with segments
+/// planned ahead of time. Each segment stores, for every joint, up to three
+/// quintic polynomials: one for minimum-jerk and spline segments, and
+/// accelerate/cruise/decelerate for trapezoidal ones. update() then only
+/// selects the phase and runs Horner's rule per joint, a few multiply-adds
+/// each for position, velocity and acceleration.
+///
+/// Segments live in a preallocated single-producer/single-consumer ring.
+/// A planning thread may therefore stream new moves while the control loop
+/// calls update(), and neither side locks. The control loop never
+/// allocates. Moves are planned from the end state of the previously queued
+/// segment, so a streamed trajectory stays continuous. When the ring runs
+/// dry, the trajectory holds the last position at rest.
+///
+/// \code
+/// Trajectory traj(7);
+/// traj.reset(robot.get_joint_positions());
+/// traj.add_trapezoidal(home, max_vel, max_acc);
+/// traj.add_spline(waypoints, times);
+/// while (!traj.is_done()) {
+///     robot.update();
+///     traj.update(clock.get_elapsed_time());
+///     robot.set_joint_torques(pid.calculate(traj.get_positions(), robot.get_last_joint_positions(),
+///                                           clock.get_elapsed_time()));
+///     timer.wait();
+/// }
+/// \endcode
+///
+/// \see PidBank, Robot, Waveform
@@ -0,0 +1,96 @@
+// MIT License
+//
+// MEL - Mechatronics Engine & Library
+// Copyright (c) 2019 Mechatronics and Haptic Interfaces Lab - Rice University
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// Author(s): Evan Pezent (epezent@rice.edu)
+
+#pragma once
+
+#include <MEL/Math/Waveform.hpp>
+#include <MEL/Core/Types.hpp>
+#include <vector>
+
+namespace mel {
+
+//==============================================================================
+// CLASS DECLARATION
+//==============================================================================
+
+/// Evaluates many Waveforms plus uniform noise at a single Time in one call
+class WaveformBank {
+public:
+    /// Constructs a bank of size channels, each initially zero
+    WaveformBank(std::size_t size = 0, uint32 seed = 0x9E3779B9);
+
+    /// Resizes the bank. New channels are initially zero.
+    void resize(std::size_t size);
+
+    /// Returns the number of channels in the bank
+    std::size_t size() const;
+
+    /// Sets channel i to follow a Waveform, with phase given as a fraction of
+    /// a period (e.g. 0.25 for a quarter period lead)
+    void set_waveform(std::size_t i, const Waveform& waveform, double phase = 0.0);
+
+    /// Sets the amplitude of uniform noise added to channel i
+    void set_noise(std::size_t i, double amplitude);
+
+    /// Reseeds the per-channel noise generators
+    void seed(uint32 seed);
+
+    /// Evaluates all channels at Time t into values, which must hold size() elements
+    void evaluate(Time t, double* values);
+
+    /// Evaluates all channels at Time t into values, resizing it if needed
+    void operator()(Time t, std::vector<double>& values);
+
+private:
+
+    std::vector<double> frequency_;  ///< cycles per second
+    std::vector<double> phase_;      ///< phase [cycles]
+    std::vector<double> sin_;        ///< sine amplitude
+    std::vector<double> square_;     ///< square amplitude
+    std::vector<double> triangle_;   ///< triangle amplitude
+    std::vector<double> sawtooth_;   ///< sawtooth amplitude
+    std::vector<double> offset_;     ///< constant offset
+    std::vector<double> noise_;      ///< noise amplitude
+    std::vector<uint32> state_;      ///< xorshift noise state
+};
+
+}  // namespace mel
+
+//==============================================================================
+// CLASS DOCUMENTATION
+//==============================================================================
+
+/// \class mel::WaveformBank
+/// \ingroup Math
+///
+/// WaveformBank evaluates an entire set of Waveforms at once. Data is stored
+/// as one array per parameter and evaluated with branch-free loops (polynomial
+/// sine, select-based square/triangle/sawtooth, per-channel xorshift noise)
+/// so the compiler can vectorize across channels. It is intended as a
+/// vectorized source for VirtualDaq modules.
+///
+/// Usage example:
+/// \code
+/// WaveformBank bank(8);
+/// for (std::size_t i = 0; i < 8; ++i) {
+///     bank.set_waveform(i, Waveform(Waveform::Sin, hertz(1)), i / 8.0);
+///     bank.set_noise(i, 0.01);
+/// }
+/// daq.AI.set_vector_source(std::ref(bank));
+/// \endcode
+///
+/// \see Waveform, VirtualDaq
@@ -18,13 +18,16 @@
 #pragma once
 #include <MEL/Mechatronics/Actuator.hpp>
 #include <MEL/Mechatronics/Amplifier.hpp>
+#include <MEL/Mechatronics/FaultChannel.hpp>
 #include <MEL/Mechatronics/ForceSensor.hpp>
 #include <MEL/Mechatronics/Joint.hpp>
 #include <MEL/Mechatronics/Limiter.hpp>
 #include <MEL/Mechatronics/Motor.hpp>
 #include <MEL/Mechatronics/PdController.hpp>
+#include <MEL/Mechatronics/PidBank.hpp>
 #include <MEL/Mechatronics/PidController.hpp>
 #include <MEL/Mechatronics/PositionSensor.hpp>
 #include <MEL/Mechatronics/Robot.hpp>
+#include <MEL/Mechatronics/RobotModel.hpp>
 #include <MEL/Mechatronics/VelocitySensor.hpp>
 #include <MEL/Mechatronics/VirtualVelocitySensor.hpp>
@@ -0,0 +1,177 @@
+// MIT License
+//
+// MEL - Mechatronics Engine & Library
+// Copyright (c) 2019 Mechatronics and Haptic Interfaces Lab - Rice University
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// Author(s): Evan Pezent (epezent@rice.edu)
+
+#pragma once
+
+#include <MEL/Core/Clock.hpp>
+#include <MEL/Core/NonCopyable.hpp>
+#include <MEL/Utility/RealtimeThread.hpp>
+#include <atomic>
+#include <memory>
+#include <string>
+
+namespace mel {
+
+//==============================================================================
+// FAULT EVENT
+//==============================================================================
+
+/// A structured limit violation recorded by a Joint, Robot or Limiter
+struct FaultEvent {
+    /// Which limit was violated
+    enum Kind {
+        PositionMin,  ///< position below the minimum position limit
+        PositionMax,  ///< position above the maximum position limit
+        Velocity,     ///< velocity magnitude above the velocity limit
+        Torque,       ///< command torque magnitude above the torque limit
+        Limit         ///< value modified by a Limiter
+    };
+
+    char source[32];  ///< name of the reporting device (truncated)
+    Kind kind;        ///< which limit was violated
+    bool active;      ///< true at the onset of a violation, false when it clears
+    double value;     ///< offending value at onset, peak value when cleared
+    double limit;     ///< the limit that was violated
+    Time time;        ///< FaultChannel time at which the event was recorded
+    uint32 count;     ///< number of consecutive violating checks (when cleared)
+};
+
+//==============================================================================
+// CLASS DECLARATION
+//==============================================================================
+
+/// Lock-free ring of FaultEvents drained and logged off the control thread
+class FaultChannel : NonCopyable {
+public:
+    /// Constructor. Capacity is rounded up to a power of two.
+    FaultChannel(std::size_t capacity = 256);
+
+    /// Destructor. Stops the logging thread if it is running.
+    ~FaultChannel();
+
+    /// Records an event without locking or allocating. Safe to call from
+    /// multiple threads. Returns false and counts a drop if the ring is full.
+    bool push(const FaultEvent& event);
+
+    /// Removes the oldest event. Call from a single consumer thread only.
+    bool pop(FaultEvent& event);
+
+    /// Pops and logs up to max_events events and reports any new drops.
+    /// Returns the number of events logged.
+    std::size_t log(std::size_t max_events = 8);
+
+    /// Launches a normal priority thread that calls log(max_events) every
+    /// period, limiting the log rate to max_events per period
+    bool start_logging(Time period = milliseconds(100), std::size_t max_events = 8);
+
+    /// Stops the logging thread and logs any events still in the ring
+    void stop_logging();
+
+    /// Gets the time since the channel was created, used to stamp events
+    Time get_time() const;
+
+    /// Gets the number of events dropped because the ring was full
+    uint64 get_dropped() const;
+
+    /// Gets the process-wide channel used by Joints by default. Getting it
+    /// starts no thread; it starts logging with the default rate limit when
+    /// the first event is pushed, and stops in an atexit handler registered
+    /// then, so that its final log() runs before the logger is destroyed.
+    static FaultChannel& get_default();
+
+private:
+    /// Ring slot tagged with a sequence number
+    struct Cell {
+        std::atomic<std::size_t> sequence;
+        FaultEvent event;
+    };
+
+    std::unique_ptr<Cell[]> cells_;        ///< preallocated ring
+    std::size_t mask_;                     ///< capacity - 1
+    std::atomic<std::size_t> enqueue_pos_; ///< next slot to write
+    std::size_t dequeue_pos_;              ///< next slot to read (consumer only)
+    std::atomic<uint64> dropped_;          ///< events dropped on a full ring
+    uint64 dropped_logged_;                ///< drops already reported by log()
+    Clock clock_;                          ///< event time base
+    RealtimeThread thread_;                ///< logging thread
+    std::atomic<bool> logging_;            ///< logging thread run flag
+    std::atomic<bool> start_on_push_;      ///< start logging on the next push (default channel)
+};
+
+//==============================================================================
+// CLASS DECLARATION
+//==============================================================================
+
+/// Coalesces repeated violations of one limit into onset and clear events
+class FaultLatch {
+public:
+    /// Constructor
+    FaultLatch();
+
+    /// Updates the latch with the result of a limit check. Pushes an onset
+    /// event on the first violating check and a cleared event with the onset
+    /// limit, peak value and repeat count on the first passing check after
+    /// that.
+    void update(FaultChannel* channel,
+                const std::string& source,
+                FaultEvent::Kind kind,
+                bool violated,
+                double value,
+                double limit);
+
+    /// Returns true while the limit is being violated
+    bool is_active() const;
+
+private:
+    bool active_;   ///< limit currently violated
+    uint32 count_;  ///< consecutive violating checks
+    double peak_;   ///< largest magnitude value seen while active
+    double limit_;  ///< limit reported at onset
+};
+
+}  // namespace mel
+
+//==============================================================================
+// CLASS DOCUMENTATION
+//==============================================================================
+
+/// \class mel::FaultChannel
+/// \ingroup Mechatronics
+///
+/// mel::FaultChannel moves limit-violation reporting out of the control
+/// loop. Joints, Robots and Limiters record fixed-size FaultEvents into a
+/// preallocated ring instead of formatting and writing a log line on every
+/// violating tick. A FaultLatch in each source reduces a sustained
+/// violation to two events, one at onset and one when it clears, the
+/// second carrying the peak value and the number of violating checks.
+/// A lower priority thread drains the ring and writes at most max_events
+/// log lines per period. If the ring fills, events are dropped and counted
+/// rather than blocking the producer.
+///
+/// Joints report to FaultChannel::get_default() unless given another
+/// channel. That channel starts its logging thread only when the first
+/// event arrives, so processes that construct Joints but never violate a
+/// limit (tests, offline tools) run no extra thread.
+///
+/// \code
+/// FaultChannel faults;
+/// faults.start_logging(milliseconds(100), 8);
+/// robot.set_fault_channel(&faults);
+/// motor_limiter.set_fault_channel(&faults, "motor0");
+/// \endcode
+///
+/// \see Joint, Robot, Limiter
@@ -21,6 +21,7 @@
 #include <MEL/Core/Device.hpp>
 #include <MEL/Math/Constants.hpp>
 #include <MEL/Mechatronics/Actuator.hpp>
+#include <MEL/Mechatronics/FaultChannel.hpp>
 #include <MEL/Mechatronics/PositionSensor.hpp>
 #include <MEL/Mechatronics/VelocitySensor.hpp>
 #include <array>
@@ -70,7 +71,8 @@ public:
     /// Returns the sensed joint torque if the Actuator supports sensing
     double get_torque_sense();
 
-    /// Sets the joint torque to #new_torque
+    /// Sets the joint torque to #new_torque, reporting and saturating it if
+    /// it exceeds the torque limit
     void set_torque(double new_torque);
 
     /// Adds #additional_torque to the currently set torque
@@ -84,14 +86,18 @@ public:
     /// exceeded, false otherwise
     bool velocity_limit_exceeded();
 
-    ///  Gets last commanded torque, checks it against torque limit, and returns
-    ///  true if exceeded, false otherise
+    /// Gets last commanded torque, checks it against torque limit, and returns
+    /// true if exceeded, false otherise. Violations are reported by set_torque().
     bool torque_limit_exceeded();
 
     /// Gets current position, velocity, and torque, checks them against limits,
     /// and returns true if either exceeded, false otherwise
     bool any_limit_exceeded();
 
+    /// Sets the FaultChannel that limit violations are reported to
+    /// (FaultChannel::get_default() initially, nullptr to disable)
+    void set_fault_channel(FaultChannel* channel);
+
     /// Gets the Joint Actuator
     template <class T = Actuator>
     T* get_actuator() {
@@ -119,6 +125,8 @@ protected:
     bool on_disable() override;
 
 protected:
+    friend class Robot;
+
     Actuator* actuator_;               ///< pointer to the Actuator of this Joint
     PositionSensor* position_sensor_;  ///< pointer to the PositionSensor of this Joint
     VelocitySensor* velocity_sensor_;  ///< pointer to the VelocitySensor of this Joint
@@ -162,6 +170,12 @@ protected:
                                 ///< position limits
     bool has_velocity_limit_;   ///< whether or not the Joint should check
                                 ///< velocity limits
+
+    FaultChannel* fault_channel_;     ///< channel limit violations are reported to
+    FaultLatch position_min_fault_;   ///< coalesces min position violations
+    FaultLatch position_max_fault_;   ///< coalesces max position violations
+    FaultLatch velocity_fault_;       ///< coalesces velocity violations
+    FaultLatch torque_fault_;         ///< coalesces torque violations
 };
 
 }  // namespace mel
@@ -18,6 +18,7 @@
 #pragma once
 
 #include <MEL/Core/Clock.hpp>
+#include <MEL/Mechatronics/FaultChannel.hpp>
 
 namespace mel {
 
@@ -59,6 +60,10 @@ public:
     /// Resets the Limiter accumulator and clock (Accumulate mode only)
     void reset();
 
+    /// Reports values modified by limit() to a FaultChannel under the given
+    /// source name (nullptr, the default, disables reporting)
+    void set_fault_channel(FaultChannel* channel, const std::string& source);
+
 private:
     /// Represents limitation modes
     enum Mode {
@@ -82,6 +87,9 @@ private:
     double limited_value_;  ///< modified value after applying limits
     Clock clock_;           ///< internal clock for regulating Accumulate mode
     bool exceeded_;         ///< is true when any limit is exceeded
+    FaultChannel* fault_channel_;  ///< channel limit events are reported to
+    std::string fault_source_;     ///< source name used in limit events
+    FaultLatch fault_latch_;       ///< coalesces repeated limit events
 };
 
 }  // namespace mel
\ No newline at end of file
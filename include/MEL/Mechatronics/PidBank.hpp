@@ -0,0 +1,128 @@
+// MIT License
+//
+// MEL - Mechatronics Engine & Library
+// Copyright (c) 2019 Mechatronics and Haptic Interfaces Lab - Rice University
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// Author(s): Evan Pezent (epezent@rice.edu)
+
+#pragma once
+
+#include <MEL/Core/Frequency.hpp>
+#include <MEL/Core/Time.hpp>
+#include <vector>
+
+namespace mel {
+
+//==============================================================================
+// CLASS DECLARATION
+//==============================================================================
+
+/// Bank of PID controllers evaluated together over contiguous arrays
+class PidBank {
+public:
+    /// Constructor. All axes start with the same gains, no limits and no
+    /// derivative filtering.
+    PidBank(std::size_t axes, double kp = 0.0, double ki = 0.0, double kd = 0.0);
+
+    /// Gets the number of axes
+    std::size_t size() const;
+
+    /// Sets the gains of one axis
+    void set_gains(std::size_t axis, double kp, double ki, double kd);
+
+    /// Clamps the integral term (ki * integral) of one axis to +/- limit.
+    /// This is the bank's anti-windup.
+    void set_integral_limit(std::size_t axis, double limit);
+
+    /// Clamps the control effort of one axis to +/- limit
+    void set_effort_limit(std::size_t axis, double limit);
+
+    /// Low-pass filters the error derivative of all axes with a first order
+    /// filter at the given cutoff (zero disables filtering)
+    void set_derivative_cutoff(Frequency cutoff);
+
+    /// Calculates the control efforts of all axes given the desired
+    /// references and actual states, differentiating the error
+    const std::vector<double>& calculate(const std::vector<double>& x_ref,
+                                         const std::vector<double>& x,
+                                         Time t);
+
+    /// Calculates the control efforts of all axes given the desired
+    /// references, actual states and actual state derivatives
+    const std::vector<double>& calculate(const std::vector<double>& x_ref,
+                                         const std::vector<double>& x,
+                                         const std::vector<double>& xdot,
+                                         Time t);
+
+    /// Gets the control efforts from the last call to calculate()
+    const std::vector<double>& get_efforts() const;
+
+    /// Resets the integral, derivative and timing state of all axes
+    void reset();
+
+public:
+    std::vector<double> kp;  ///< the proportional control gains
+    std::vector<double> ki;  ///< the integral control gains
+    std::vector<double> kd;  ///< the derivative control gains
+
+private:
+    /// Computes the shared time step terms for this tick
+    void step(Time t, double& half_dt, double& inv_dt, double& alpha);
+
+private:
+    std::size_t axes_;                   ///< number of axes
+    std::vector<double> integral_max_;   ///< integral term limits
+    std::vector<double> effort_max_;     ///< effort limits
+    std::vector<double> error_;          ///< errors at the last tick
+    std::vector<double> integral_;       ///< integral terms (ki * error integral)
+    std::vector<double> derivative_;     ///< filtered error derivatives
+    std::vector<double> effort_;         ///< control efforts
+    double tau_;                         ///< derivative filter time constant [s]
+    Time last_t_;                        ///< time of the last tick
+    bool started_;                       ///< true after the first tick
+};
+
+}  // namespace mel
+
+//==============================================================================
+// CLASS DOCUMENTATION
+//==============================================================================
+
+/// \class mel::PidBank
+/// \ingroup Mechatronics
+///
+/// mel::PidBank evaluates N PID loops in one call. Gains and states are held
+/// in one array per quantity rather than in N PidController objects, and
+/// every axis shares the tick's time step, so the per-axis update is a
+/// branch-free loop the compiler vectorizes. The integral term (ki times the
+/// trapezoidal error integral) is accumulated directly, so gain changes do
+/// not bump the output.
+/// The error derivative is a backward difference passed through an
+/// optional first order low-pass. Anti-windup clamps the integral term to
+/// +/- its limit, and the effort is clamped to +/- its limit.
+///
+/// \code
+/// PidBank pid(7, 100.0, 10.0, 2.0);
+/// pid.set_derivative_cutoff(hertz(50));
+/// for (std::size_t i = 0; i < pid.size(); ++i) {
+///     pid.set_integral_limit(i, 1.0);
+///     pid.set_effort_limit(i, 5.0);
+/// }
+/// while (running) {
+///     robot.update();
+///     robot.set_joint_torques(pid.calculate(ref, robot.get_last_joint_positions(), clock.get_elapsed_time()));
+///     ...
+/// }
+/// \endcode
+///
+/// \see PidController, PdController
@@ -22,6 +22,7 @@
 #include <MEL/Core/Device.hpp>
 #include <MEL/Mechatronics/Joint.hpp>
 #include <MEL/Mechatronics/PositionSensor.hpp>
+#include <MEL/Mechatronics/RobotModel.hpp>
 #include <MEL/Core/Types.hpp>
 #include <vector>
 
@@ -49,14 +50,54 @@ public:
     /// Gets a reference to a Robot's Joint
     Joint& operator[](uint32 joint_number);
 
-    /// Get the most recently read robot joint positions.
-    std::vector<double> get_joint_positions();
+    /// Reads the positions and velocities of all joints in a single pass into
+    /// the Robot's contiguous joint arrays. Call once per control loop after
+    /// the DAQ input update, then use the get_last_joint_*() accessors.
+    void update();
 
-    /// Get the most recently read robot joint velocities.
-    std::vector<double> get_joint_velocities();
+    /// Reads and returns the robot joint positions. The returned reference
+    /// stays valid until the next call to add_joint().
+    const std::vector<double>& get_joint_positions();
 
-    /// Set the desired robot joint torques.
-    void set_joint_torques(std::vector<double> new_torques);
+    /// Reads and returns the robot joint velocities. The returned reference
+    /// stays valid until the next call to add_joint().
+    const std::vector<double>& get_joint_velocities();
+
+    /// Returns the joint positions read by the last call to update() or
+    /// get_joint_positions() without reading the sensors again.
+    const std::vector<double>& get_last_joint_positions() const;
+
+    /// Returns the joint velocities read by the last call to update() or
+    /// get_joint_velocities() without reading the sensors again.
+    const std::vector<double>& get_last_joint_velocities() const;
+
+    /// Returns the joint torques commanded by the last call to
+    /// set_joint_torques(), after saturation.
+    const std::vector<double>& get_joint_torques() const;
+
+    /// Sets the desired robot joint torques, saturating and reporting any
+    /// that exceed their joint torque limit. This is a loop of
+    /// Joint::set_torque() calls; each Actuator writes its own AO channel, and
+    /// the values reach the hardware on the next DAQ update_output().
+    void set_joint_torques(const std::vector<double>& new_torques);
+
+    /// Sets the FaultChannel that all current joints report limit violations to
+    void set_fault_channel(FaultChannel* channel);
+
+    /// Loads the kinematic/dynamic model of the joint chain from a file (see
+    /// RobotModel::load()). The model must have one link per joint.
+    bool load_model(const std::string& filepath);
+
+    /// Gets the kinematic/dynamic model of the joint chain
+    RobotModel& get_model();
+
+    /// Computes the joint torques that hold the joint positions read by the
+    /// last update() against gravity
+    const std::vector<double>& get_gravity_torques();
+
+    /// Computes the feedforward joint torques that produce the accelerations
+    /// qdd at the joint positions and velocities read by the last update()
+    const std::vector<double>& get_inverse_dynamics(const std::vector<double>& qdd);
 
     /// Checks position limits of all joints and returns true if any exceeded,
     /// false otherwise
@@ -85,10 +126,10 @@ protected:
 protected:
 
     std::vector<Joint> joints_;             ///< Vector of Joints.
-    std::vector<double> joint_positions_;   ///< Stores the robot joint positions since the last
-                                            ///< call of get_joint_positions().
-    std::vector<double> joint_velocities_;  ///< Stores the robot joint velocities since the
-                                            ///< last call of get_joint_velocities().
+    std::vector<double> joint_positions_;   ///< joint positions since the last read
+    std::vector<double> joint_velocities_;  ///< joint velocities since the last read
+    std::vector<double> joint_torques_;     ///< joint torques since the last command
+    RobotModel model_;                      ///< kinematic/dynamic model of the joints
 };
 
 }  // namespace mel
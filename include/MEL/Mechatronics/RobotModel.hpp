@@ -0,0 +1,170 @@
+// MIT License
+//
+// MEL - Mechatronics Engine & Library
+// Copyright (c) 2019 Mechatronics and Haptic Interfaces Lab - Rice University
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// Author(s): Evan Pezent (epezent@rice.edu)
+
+#pragma once
+
+#include <array>
+#include <string>
+#include <vector>
+
+namespace mel {
+
+//==============================================================================
+// CLASS DECLARATION
+//==============================================================================
+
+/// Kinematic and dynamic model of a serial joint chain
+class RobotModel {
+public:
+    /// Type of the joint that moves a link
+    enum JointType {
+        Revolute,  ///< joint variable is theta
+        Prismatic  ///< joint variable is d
+    };
+
+    /// One link of the chain, described with modified (Craig) Denavit-Hartenberg
+    /// parameters relative to the previous link frame, and its rigid-body
+    /// inertia expressed in its own frame
+    struct Link {
+        JointType type;                ///< type of the joint moving this link
+        double a;                      ///< a(i-1), distance along the previous x
+        double alpha;                  ///< alpha(i-1), twist about the previous x [rad]
+        double d;                      ///< d(i), offset along z (added to q if prismatic)
+        double theta;                  ///< theta(i), angle about z (added to q if revolute) [rad]
+        double mass;                   ///< link mass
+        std::array<double, 3> com;     ///< center of mass in the link frame
+        std::array<double, 6> inertia; ///< inertia tensor elements Ixx, Iyy, Izz, Ixy, Ixz, Iyz
+                                       ///< about the center of mass
+    };
+
+public:
+    /// Constructs an empty model with gravity (0, 0, -9.81)
+    RobotModel();
+
+    /// Appends a link to the end of the chain
+    void add_link(const Link& link);
+
+    /// Replaces the chain with links read from a file, one link per line:
+    /// type (0 revolute, 1 prismatic), a, alpha, d, theta, mass, com x y z,
+    /// Ixx, Iyy, Izz, Ixy, Ixz, Iyz. Values are comma separated, and blank
+    /// lines and lines starting with # are skipped.
+    bool load(const std::string& filepath);
+
+    /// Gets the number of links (and joints)
+    std::size_t size() const;
+
+    /// Gets a link of the chain
+    const Link& get_link(std::size_t i) const;
+
+    /// Sets the gravity vector in the base frame
+    void set_gravity(const std::array<double, 3>& gravity);
+
+    /// Sets the tool point in the last link frame used by the Jacobian
+    void set_tool(const std::array<double, 3>& tool);
+
+    /// Computes the pose of every link frame and the tool point
+    bool forward_kinematics(const std::vector<double>& q);
+
+    /// Gets the origin of link frame i in the base frame from the last
+    /// forward_kinematics(), jacobian() or inverse_dynamics() call
+    std::array<double, 3> get_frame_position(std::size_t i) const;
+
+    /// Gets the rotation (row-major) of link frame i relative to the base
+    std::array<double, 9> get_frame_rotation(std::size_t i) const;
+
+    /// Gets the tool point in the base frame
+    std::array<double, 3> get_tool_position() const;
+
+    /// Computes the 6 x n geometric Jacobian of the tool point in the base
+    /// frame, stored column-major (linear then angular rows per joint)
+    const std::vector<double>& jacobian(const std::vector<double>& q);
+
+    /// Computes joint torques (forces for prismatic joints) that produce the
+    /// accelerations qdd at positions q and velocities qd with the
+    /// Recursive Newton-Euler algorithm
+    const std::vector<double>& inverse_dynamics(const std::vector<double>& q,
+                                                const std::vector<double>& qd,
+                                                const std::vector<double>& qdd);
+
+    /// Computes the joint torques that hold positions q against gravity
+    const std::vector<double>& gravity_torques(const std::vector<double>& q);
+
+private:
+    /// Per-link state, preallocated so that no call allocates
+    struct State {
+        double R[9];   ///< rotation of this frame in the previous one
+        double p[3];   ///< origin of this frame in the previous one
+        double R0[9];  ///< rotation of this frame in the base
+        double p0[3];  ///< origin of this frame in the base
+        double w[3];   ///< angular velocity (this frame)
+        double wd[3];  ///< angular acceleration (this frame)
+        double vd[3];  ///< linear acceleration of the origin (this frame)
+        double f[3];   ///< force exerted on this link by the previous one
+        double n[3];   ///< moment exerted on this link by the previous one
+    };
+
+    /// Computes the local and base transforms of all links at q
+    void transforms(const double* q);
+
+    /// Checks that an argument has one value per joint
+    bool check_size(const std::vector<double>& v, const char* name) const;
+
+private:
+    std::vector<Link> links_;      ///< chain description
+    std::vector<State> states_;    ///< per-link working state
+    std::array<double, 3> gravity_;///< gravity in the base frame
+    std::array<double, 3> tool_;   ///< tool point in the last frame
+    std::vector<double> zeros_;    ///< n zeros for gravity_torques()
+    std::vector<double> tau_;      ///< last computed joint torques
+    std::vector<double> jacobian_; ///< last computed Jacobian
+};
+
+}  // namespace mel
+
+//==============================================================================
+// CLASS DOCUMENTATION
+//==============================================================================
+
+/// \class mel::RobotModel
+/// \ingroup Mechatronics
+///
+/// mel::RobotModel holds a joint-chain description and computes forward
+/// kinematics, the tool-point Jacobian and inverse dynamics for it. Inverse
+/// dynamics uses the Recursive Newton-Euler algorithm. An outward pass
+/// propagates link velocities and accelerations (with gravity entering as
+/// a base acceleration), and an inward pass accumulates link forces into
+/// joint torques. Every call is O(n) and works in preallocated buffers.
+///
+/// A Robot owns a RobotModel (see Robot::load_model()) and can compute
+/// gravity and feedforward torques from the joint positions and velocities
+/// read by Robot::update().
+///
+/// Example model file for a planar two link arm moving in the x-y plane:
+/// \code
+/// # type, a, alpha, d, theta, mass, cx, cy, cz, Ixx, Iyy, Izz, Ixy, Ixz, Iyz
+/// 0, 0.0, 0, 0, 0, 1.0, 0.15, 0, 0, 0, 0, 0.01, 0, 0, 0
+/// 0, 0.3, 0, 0, 0, 0.8, 0.12, 0, 0, 0, 0, 0.008, 0, 0, 0
+/// \endcode
+///
+/// \code
+/// RobotModel model;
+/// model.load("arm.csv");
+/// model.set_gravity({ 0, -9.81, 0 });
+/// auto& tau = model.inverse_dynamics(q, qd, qdd);
+/// \endcode
+///
+/// \see Robot, Trajectory
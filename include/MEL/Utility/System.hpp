@@ -64,7 +64,8 @@ void sleep(Time duration);
 /// Gets the last operating system error
 std::string get_last_os_error();
 
-/// Enables real-time OS priority. The program must be run 'As Administrator' on Windows
+/// Enables real-time OS priority. The program must be run 'As Administrator' on Windows.
+/// For per-thread priority, CPU affinity and memory locking use RealtimeThread.
 bool enable_realtime();
 
 /// Disables real-time OS priority. The program must be run 'As Administrator' on Windows
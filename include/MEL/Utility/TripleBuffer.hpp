@@ -0,0 +1,119 @@
+// MIT License
+//
+// MEL - Mechatronics Engine & Library
+// Copyright (c) 2019 Mechatronics and Haptic Interfaces Lab - Rice University
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// Author(s): Evan Pezent (epezent@rice.edu)
+
+#pragma once
+#include <MEL/Core/NonCopyable.hpp>
+#include <atomic>
+
+namespace mel {
+
+//==============================================================================
+// CLASS DECLARATION
+//==============================================================================
+
+/// Wait-free single-producer/single-consumer latest-value buffer
+template <typename T>
+class TripleBuffer : NonCopyable {
+public:
+    /// Constructor
+    TripleBuffer(const T& initial = T())
+        : back_(0), front_(2), middle_(1) {
+        reset(initial);
+    }
+
+    /// Sets all three buffers to value and discards unread data. Not
+    /// thread-safe; call before the writer and reader threads start.
+    void reset(const T& value) {
+        for (int i = 0; i < 3; ++i)
+            buffers_[i] = value;
+        back_  = 0;
+        front_ = 2;
+        middle_.store(1, std::memory_order_relaxed);
+    }
+
+    /// Writer: gets the buffer to fill before calling publish()
+    T& write_buffer() {
+        return buffers_[back_];
+    }
+
+    /// Writer: makes the write buffer the latest value. Returns true if the
+    /// previously published value was overwritten before it was read.
+    bool publish() {
+        unsigned prev = middle_.exchange(back_ | DIRTY, std::memory_order_acq_rel);
+        back_ = prev & INDEX;
+        return (prev & DIRTY) != 0;
+    }
+
+    /// Reader: swaps in the latest published value if there is one. Returns
+    /// true if read_buffer() changed.
+    bool update() {
+        if (!(middle_.load(std::memory_order_relaxed) & DIRTY))
+            return false;
+        unsigned prev = middle_.exchange(front_, std::memory_order_acq_rel);
+        front_ = prev & INDEX;
+        return true;
+    }
+
+    /// Reader: gets the most recently swapped in value
+    T& read_buffer() {
+        return buffers_[front_];
+    }
+
+    /// Reader: gets the most recently swapped in value
+    const T& read_buffer() const {
+        return buffers_[front_];
+    }
+
+private:
+    static const unsigned INDEX = 3;  ///< mask of the buffer index in middle_
+    static const unsigned DIRTY = 4;  ///< set when middle_ holds unread data
+
+    T buffers_[3];                  ///< back, middle and front buffers
+    unsigned back_;                 ///< writer owned buffer index
+    unsigned front_;                ///< reader owned buffer index
+    std::atomic<unsigned> middle_;  ///< shared buffer index and dirty flag
+};
+
+}  // namespace mel
+
+//==============================================================================
+// CLASS DOCUMENTATION
+//==============================================================================
+
+/// \class mel::TripleBuffer
+/// \ingroup Utility
+///
+/// TripleBuffer hands the latest value of a T from one writer thread to one
+/// reader thread without locks or waiting. The writer always has a private
+/// buffer to fill and the reader always has a private buffer to read, and the
+/// two exchange ownership of a third buffer with one atomic swap. Unlike a
+/// seqlock, neither side ever touches memory the other is writing, so T may
+/// be any copyable type (including std::vector). Intermediate values are
+/// dropped if the writer publishes faster than the reader updates.
+///
+/// Usage example:
+/// \code
+/// TripleBuffer<std::vector<double>> buf(std::vector<double>(8));
+/// // writer thread
+/// buf.write_buffer()[0] = 1.0;
+/// buf.publish();
+/// // reader thread
+/// if (buf.update())
+///     use(buf.read_buffer());
+/// \endcode
+///
+/// \see AsyncDaq
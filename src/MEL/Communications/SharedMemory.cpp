@@ -27,11 +27,12 @@ SharedMemory::SharedMemory(const std::string& name, OpenMode mode, std::size_t m
     : name_(name),
       max_bytes_(max_bytes),
       buffer_(nullptr),
-      is_mapped_(false)
+      is_mapped_(false),
+      created_(false)
 {
     switch (mode) {
         case OpenOrCreate: {
-            if (open_or_create(map_, name_, max_bytes_)) {
+            if (open_or_create(map_, name_, max_bytes_, created_)) {
                 buffer_ = map_buffer(map_, max_bytes_);
                 if (buffer_)
                     is_mapped_ = true;
@@ -51,7 +52,7 @@ SharedMemory::SharedMemory(const std::string& name, OpenMode mode, std::size_t m
 
 SharedMemory::~SharedMemory() {
     unmap_buffer(buffer_, max_bytes_);
-    close(name_, map_);
+    close(name_, map_, created_);
 }
 
 bool SharedMemory::write(const void* data,
@@ -90,7 +91,7 @@ bool SharedMemory::is_mapped() const {
 // WINDOWS IMPLEMENTATION
 //==============================================================================
 
-bool SharedMemory::open_or_create(MapHandle& map, const std::string& name, std::size_t size)
+bool SharedMemory::open_or_create(MapHandle& map, const std::string& name, std::size_t size, bool& created)
 {
     HANDLE hMapFile;
     hMapFile = ::CreateFileMappingA(
@@ -124,7 +125,7 @@ bool SharedMemory::open_only(MapHandle& map, const std::string& name) {
     return true;
 }
 
-void SharedMemory::close(const std::string& name, MapHandle map) {
+void SharedMemory::close(const std::string& name, MapHandle map, bool unlink) {
     if (::CloseHandle(map) == 0) {
         LOG(Error) << "Failed to close file mapping handle "  << name << " (Windows Error #"
                    << (int)GetLastError() << ")";
@@ -154,13 +155,14 @@ void SharedMemory::unmap_buffer(void* buffer, std::size_t) {
 // UNIX IMPLEMENTATION
 //==============================================================================
 
-bool SharedMemory::open_or_create(MapHandle& map, const std::string& name, std::size_t size) {
+bool SharedMemory::open_or_create(MapHandle& map, const std::string& name, std::size_t size, bool& created) {
     map = shm_open(name.c_str(), O_RDWR, 0666);
     if (map != -1) {
         LOG(Verbose) << "Opened existing file mapping object " << name;
         return true;
     }
     map = shm_open(name.c_str(), O_CREAT | O_RDWR, 0666);
+    created = map != -1;
     if (map == -1) {
         LOG(Error) << "Could not create file mapping object " << name
                    << " (Error # " << errno << " - " << strerror(errno) << ")";
@@ -189,9 +191,11 @@ bool SharedMemory::open_only(MapHandle& map, const std::string& name) {
     return false;
 }
 
-void SharedMemory::close(const std::string& name, MapHandle map) {
+void SharedMemory::close(const std::string& name, MapHandle map, bool unlink) {
     ::close(map);
-    ::shm_unlink(name.c_str());  // this should probably be called by the LAST process
+    // only the creator removes the name, so other processes can still open it
+    if (unlink)
+        ::shm_unlink(name.c_str());
 }
 
 void* SharedMemory::map_buffer(MapHandle map, std::size_t size) {
@@ -1,4 +1,5 @@
 #include <MEL/Core/Clock.hpp>
+#include <atomic>
 
 #ifdef _WIN32
 #include <windows.h>
@@ -8,8 +9,119 @@
 #include <time.h>
 #endif
 
+#if defined(_M_X64) || defined(_M_IX86)
+#include <intrin.h>
+#define MEL_CLOCK_TSC
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#include <cpuid.h>
+#define MEL_CLOCK_TSC
+#endif
+
 namespace mel {
 
+/// Reads the current time from the OS high resolution clock
+static Time os_current_time();
+
+//==============================================================================
+// TSC IMPLEMENTATION
+//==============================================================================
+
+namespace {
+
+/// Linear mapping from TSC ticks to OS clock nanoseconds
+struct TscCalibration {
+    int64  base_ticks;    ///< TSC reading at end of calibration
+    int64  base_ns;       ///< OS time at end of calibration [ns]
+    double ns_per_tick;   ///< measured TSC period [ns]
+};
+
+// g_tsc is written before g_use_tsc is set with release ordering, so any
+// thread that acquires g_use_tsc == true also sees the calibration
+std::atomic<bool> g_use_tsc(false);
+TscCalibration    g_tsc = {0, 0, 0.0};
+
+#ifdef MEL_CLOCK_TSC
+
+inline int64 read_tsc() {
+    return static_cast<int64>(__rdtsc());
+}
+
+bool has_invariant_tsc() {
+    // CPUID.80000007H:EDX[8] indicates the TSC runs at a constant rate
+    // in all ACPI P-, C- and T-states
+#ifdef _MSC_VER
+    int regs[4];
+    __cpuid(regs, 0x80000000);
+    if (static_cast<unsigned int>(regs[0]) < 0x80000007)
+        return false;
+    __cpuid(regs, 0x80000007);
+    return (regs[3] & (1 << 8)) != 0;
+#else
+    unsigned int eax, ebx, ecx, edx;
+    if (__get_cpuid_max(0x80000000, nullptr) < 0x80000007)
+        return false;
+    __get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx);
+    return (edx & (1 << 8)) != 0;
+#endif
+}
+
+/// Reads an (OS time, TSC) pair, bracketing the OS read with two TSC reads
+/// and keeping the tightest of several attempts
+void sample_pair(int64& ns, int64& ticks) {
+    int64 best = -1;
+    for (int i = 0; i < 8; ++i) {
+        int64 before = read_tsc();
+        int64 now_ns = os_current_time().as_nanoseconds();
+        int64 after  = read_tsc();
+        if (best < 0 || after - before < best) {
+            best  = after - before;
+            ns    = now_ns;
+            ticks = before + (after - before) / 2;
+        }
+    }
+}
+
+bool calibrate_tsc(Time duration) {
+    if (!has_invariant_tsc())
+        return false;
+    int64 ns0, ticks0, ns1, ticks1;
+    sample_pair(ns0, ticks0);
+    while (os_current_time().as_nanoseconds() - ns0 < duration.as_nanoseconds()) {
+        // spin rather than sleep so the core stays out of deep C-states
+    }
+    sample_pair(ns1, ticks1);
+    if (ticks1 <= ticks0)
+        return false;
+    g_tsc.ns_per_tick = static_cast<double>(ns1 - ns0) / static_cast<double>(ticks1 - ticks0);
+    g_tsc.base_ticks  = ticks1;
+    g_tsc.base_ns     = ns1;
+    return true;
+}
+
+inline Time tsc_current_time() {
+    int64 delta = read_tsc() - g_tsc.base_ticks;
+    return nanoseconds(g_tsc.base_ns + static_cast<int64>(static_cast<double>(delta) * g_tsc.ns_per_tick));
+}
+
+#else
+
+bool has_invariant_tsc() {
+    return false;
+}
+
+bool calibrate_tsc(Time) {
+    return false;
+}
+
+inline Time tsc_current_time() {
+    return os_current_time();
+}
+
+#endif
+
+}  // namespace
+
 //==============================================================================
 // CLASS DEFINITIONS
 //==============================================================================
@@ -30,6 +142,32 @@ Time Clock::restart() {
     return elapsed;
 }
 
+bool Clock::set_source(Source source, Time calibration) {
+    if (source == Source::Os) {
+        g_use_tsc.store(false);
+        return true;
+    }
+    // calibrate while still reading the OS clock, then switch over
+    g_use_tsc.store(false);
+    if (!calibrate_tsc(calibration))
+        return false;
+    g_use_tsc.store(true, std::memory_order_release);
+    return true;
+}
+
+Clock::Source Clock::get_source() {
+    return g_use_tsc.load(std::memory_order_acquire) ? Source::Tsc : Source::Os;
+}
+
+bool Clock::is_tsc_available() {
+    return has_invariant_tsc();
+}
+
+Time Clock::get_current_time() {
+    if (g_use_tsc.load(std::memory_order_acquire))
+        return tsc_current_time();
+    return os_current_time();
+}
 
 
 //==============================================================================
@@ -44,15 +182,17 @@ LARGE_INTEGER get_frequency() {
     return frequency;
 }
 
-Time Clock::get_current_time() {
+static Time os_current_time() {
     // Get the frequency of the performance counter
     // (it is constant across the program lifetime)
     static LARGE_INTEGER frequency = get_frequency();
     LARGE_INTEGER time;
    // Get the current time
     QueryPerformanceCounter(&time);
-    // Return the current time as microseconds
-    return mel::microseconds(1000000 * time.QuadPart / frequency.QuadPart);
+    // Return the current time as nanoseconds (split to avoid overflow)
+    int64 secs = time.QuadPart / frequency.QuadPart;
+    int64 rem  = time.QuadPart % frequency.QuadPart;
+    return mel::nanoseconds(secs * 1000000000 + rem * 1000000000 / frequency.QuadPart);
 }
 
 #elif __APPLE__
@@ -61,12 +201,12 @@ Time Clock::get_current_time() {
 // APPLE IMPLEMENTATION
 //==============================================================================
 
-Time Clock::get_current_time() {
+static Time os_current_time() {
     static mach_timebase_info_data_t frequency = {0, 0};
     if (frequency.denom == 0)
         mach_timebase_info(&frequency);
     uint64 nanoseconds = mach_absolute_time() * frequency.numer / frequency.denom;
-    return mel::microseconds(nanoseconds / 1000);
+    return mel::nanoseconds(nanoseconds);
 }
 
 #else
@@ -75,13 +215,13 @@ Time Clock::get_current_time() {
 // LINUX IMPLEMENTATION
 //==============================================================================
 
-Time Clock::get_current_time() {
+static Time os_current_time() {
     // POSIX implementation
     // https://linux.die.net/man/3/clock_gettime
     // https://forums.ni.com/t5/NI-Linux-Real-Time-Discussions/Help-to-solve-a-problem-with-C-on-cRIO-9068/td-p/3469892
     timespec time;
     clock_gettime(CLOCK_MONOTONIC_RAW, &time);
-    return mel::microseconds(static_cast<uint64>(time.tv_sec) * 1000000 + time.tv_nsec / 1000);
+    return mel::nanoseconds(static_cast<int64>(time.tv_sec) * 1000000000 + time.tv_nsec);
 }
 
 #endif
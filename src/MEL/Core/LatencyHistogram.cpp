@@ -0,0 +1,156 @@
+#include <MEL/Core/LatencyHistogram.hpp>
+#include <MEL/Logging/Csv.hpp>
+#include <algorithm>
+#include <limits>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace mel {
+
+//==============================================================================
+// HELPER FUNCTIONS
+//==============================================================================
+
+namespace {
+
+/// Highest bucketed value is 2^36 - 1 ns, about 68.7 s
+const int64 HIGHEST_NS = (static_cast<int64>(1) << 36) - 1;
+
+inline int floor_log2(uint64 value) {
+#ifdef _MSC_VER
+    unsigned long index;
+    _BitScanReverse64(&index, value);
+    return static_cast<int>(index);
+#else
+    return 63 - __builtin_clzll(value);
+#endif
+}
+
+}  // namespace
+
+//==============================================================================
+// CLASS DEFINITIONS
+//==============================================================================
+
+LatencyHistogram::LatencyHistogram() {
+    reset();
+}
+
+void LatencyHistogram::record(Time value) {
+    int64 ns = value.as_nanoseconds();
+    if (ns < 0)
+        ns = 0;
+    else if (ns > HIGHEST_NS)
+        ns = HIGHEST_NS;
+    // values below 64 ns map one-to-one, above that each power of two is
+    // split into 32 linear sub-buckets
+    std::size_t index;
+    if (ns < (2 << SubBits)) {
+        index = static_cast<std::size_t>(ns);
+    }
+    else {
+        int shift = floor_log2(static_cast<uint64>(ns)) - SubBits;
+        index = static_cast<std::size_t>(shift << SubBits) + static_cast<std::size_t>(ns >> shift);
+    }
+    counts_[index]++;
+    count_++;
+    sum_ += static_cast<double>(ns);
+    if (ns < min_)
+        min_ = ns;
+    if (ns > max_)
+        max_ = ns;
+}
+
+void LatencyHistogram::reset() {
+    counts_.fill(0);
+    count_ = 0;
+    min_   = std::numeric_limits<int64>::max();
+    max_   = 0;
+    sum_   = 0.0;
+}
+
+int64 LatencyHistogram::get_count() const {
+    return count_;
+}
+
+Time LatencyHistogram::get_min() const {
+    return count_ > 0 ? nanoseconds(min_) : Time::Zero;
+}
+
+Time LatencyHistogram::get_max() const {
+    return nanoseconds(max_);
+}
+
+Time LatencyHistogram::get_mean() const {
+    if (count_ == 0)
+        return Time::Zero;
+    return nanoseconds(static_cast<int64>(sum_ / static_cast<double>(count_)));
+}
+
+/// Gets the lower bound [ns] of a bucket
+static int64 bucket_lower(std::size_t index, int sub_bits) {
+    std::size_t sub = static_cast<std::size_t>(1) << sub_bits;
+    if (index < 2 * sub)
+        return static_cast<int64>(index);
+    int shift = static_cast<int>(index >> sub_bits) - 1;
+    return static_cast<int64>(index - (static_cast<std::size_t>(shift) << sub_bits)) << shift;
+}
+
+/// Gets the upper bound [ns] of a bucket
+static int64 bucket_upper(std::size_t index, int sub_bits) {
+    std::size_t sub = static_cast<std::size_t>(1) << sub_bits;
+    if (index < 2 * sub)
+        return static_cast<int64>(index);
+    int shift = static_cast<int>(index >> sub_bits) - 1;
+    return bucket_lower(index, sub_bits) + (static_cast<int64>(1) << shift) - 1;
+}
+
+Time LatencyHistogram::get_percentile(double percentile) const {
+    if (count_ == 0)
+        return Time::Zero;
+    percentile = std::min(std::max(percentile, 0.0), 100.0);
+    int64 target = static_cast<int64>(percentile / 100.0 * static_cast<double>(count_) + 0.5);
+    target = std::max(target, static_cast<int64>(1));
+    int64 cumulative = 0;
+    for (std::size_t i = 0; i < BucketCount; ++i) {
+        cumulative += counts_[i];
+        if (cumulative >= target)
+            return nanoseconds(std::min(std::max(bucket_upper(i, SubBits), min_), max_));
+    }
+    return nanoseconds(max_);
+}
+
+Table LatencyHistogram::get_table(const std::string& name) const {
+    Table table(name, {"lower [ns]", "upper [ns]", "count", "percentile"});
+    int64 cumulative = 0;
+    for (std::size_t i = 0; i < BucketCount; ++i) {
+        if (counts_[i] == 0)
+            continue;
+        cumulative += counts_[i];
+        table.push_back_row({static_cast<double>(bucket_lower(i, SubBits)),
+                             static_cast<double>(bucket_upper(i, SubBits)),
+                             static_cast<double>(counts_[i]),
+                             100.0 * static_cast<double>(cumulative) / static_cast<double>(count_)});
+    }
+    return table;
+}
+
+bool LatencyHistogram::save(const std::string& filepath) const {
+    Csv csv(filepath);
+    if (!csv.is_open())
+        return false;
+    csv.set_precision(12);
+    Table table = get_table();
+    const std::vector<std::string>& cols = table.get_col_names();
+    csv.write_row(cols[0], cols[1], cols[2], cols[3]);
+    for (std::size_t i = 0; i < table.row_count(); ++i)
+        csv.write_row(table(i, 0), table(i, 1), table(i, 2), table(i, 3));
+    return true;
+}
+
+Time LatencyHistogram::get_highest_trackable() {
+    return nanoseconds(HIGHEST_NS);
+}
+
+}  // namespace mel
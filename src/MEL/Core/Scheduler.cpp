@@ -0,0 +1,121 @@
+#include <MEL/Core/Scheduler.hpp>
+#include <MEL/Logging/Log.hpp>
+
+namespace mel {
+
+//==============================================================================
+// CLASS DEFINITIONS
+//==============================================================================
+
+Scheduler::Scheduler(Frequency base_rate, Timer::WaitMode mode) :
+    timer_(base_rate, mode),
+    stop_(false)
+{
+}
+
+std::size_t Scheduler::add_task(const std::string& name,
+                                std::function<void()> task,
+                                int64 divisor,
+                                int64 phase,
+                                Time budget)
+{
+    if (divisor < 1) {
+        LOG(Warning) << "Scheduler task " << name << " divisor must be at least 1; using 1";
+        divisor = 1;
+    }
+    Task t;
+    t.name    = name;
+    t.func    = task;
+    t.divisor = divisor;
+    t.phase   = ((phase % divisor) + divisor) % divisor;
+    t.next    = t.phase;
+    t.budget  = budget > Time::Zero ? budget : timer_.get_period();
+    t.enabled = true;
+    t.stats   = {0, 0, Time::Zero, Time::Zero, Time::Zero};
+    tasks_.push_back(t);
+    return tasks_.size() - 1;
+}
+
+void Scheduler::set_task_enabled(std::size_t index, bool enabled) {
+    tasks_[index].enabled = enabled;
+}
+
+Time Scheduler::tick() {
+    // the Timer's tick count includes ticks it skipped after an overrun, so
+    // phases stay aligned to wall time; a task whose tick was skipped runs
+    // once on the first tick after it instead of waiting a whole divisor
+    int64 tick = timer_.get_elapsed_ticks();
+    for (auto& task : tasks_) {
+        if (tick < task.next)
+            continue;
+        task.next = task.phase + ((tick - task.phase) / task.divisor + 1) * task.divisor;
+        if (!task.enabled)
+            continue;
+        Clock clock;
+        task.func();
+        Time elapsed = clock.get_elapsed_time();
+        task.stats.runs++;
+        task.stats.last   = elapsed;
+        task.stats.total += elapsed;
+        if (elapsed > task.stats.max)
+            task.stats.max = elapsed;
+        if (elapsed > task.budget)
+            task.stats.overruns++;
+    }
+    return timer_.wait();
+}
+
+void Scheduler::run(Time duration) {
+    stop_ = false;
+    // don't book the time spent between construction and run() as misses
+    timer_.restart();
+    for (auto& task : tasks_)
+        task.next = task.phase;
+    while (!stop_ && timer_.get_elapsed_time() < duration)
+        tick();
+}
+
+void Scheduler::stop() {
+    stop_ = true;
+}
+
+void Scheduler::restart() {
+    for (auto& task : tasks_) {
+        task.next  = task.phase;
+        task.stats = {0, 0, Time::Zero, Time::Zero, Time::Zero};
+    }
+    timer_.restart();
+}
+
+std::size_t Scheduler::get_task_count() const {
+    return tasks_.size();
+}
+
+const std::string& Scheduler::get_task_name(std::size_t index) const {
+    return tasks_[index].name;
+}
+
+const Scheduler::TaskStats& Scheduler::get_task_stats(std::size_t index) const {
+    return tasks_[index].stats;
+}
+
+Table Scheduler::get_task_table() const {
+    Table table("scheduler_tasks", {"divisor", "phase", "runs", "overruns", "mean [us]", "max [us]", "budget [us]"});
+    for (auto& task : tasks_) {
+        double mean = task.stats.runs > 0 ? task.stats.total.as_nanoseconds() / 1000.0 / task.stats.runs : 0.0;
+        table.push_back_row({static_cast<double>(task.divisor),
+                             static_cast<double>(task.phase),
+                             static_cast<double>(task.stats.runs),
+                             static_cast<double>(task.stats.overruns),
+                             mean,
+                             task.stats.max.as_nanoseconds() / 1000.0,
+                             task.budget.as_nanoseconds() / 1000.0});
+    }
+    return table;
+}
+
+Timer& Scheduler::get_timer() {
+    return timer_;
+}
+
+}  // namespace mel
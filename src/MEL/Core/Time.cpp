@@ -9,40 +9,44 @@ namespace mel {
 //==============================================================================
 
 const Time Time::Zero;
-const Time Time::Inf = microseconds(std::numeric_limits<int64>::max()); // 29k years, effectively infinite :)
+const Time Time::Inf = nanoseconds(std::numeric_limits<int64>::max()); // 292 years, effectively infinite :)
 
 Time::Time() :
-    microseconds_(0)
+    nanoseconds_(0)
 {
 }
 
-Time::Time(int64 microseconds) :
-    microseconds_(microseconds)
+Time::Time(int64 nanoseconds) :
+    nanoseconds_(nanoseconds)
 {
 }
 
 double Time::as_seconds() const
 {
-    return microseconds_ / 1000000.0;
+    return nanoseconds_ / 1000000000.0;
 }
 
 int32 Time::as_milliseconds() const
 {
-    return static_cast<int32>(microseconds_ / 1000);
+    return static_cast<int32>(nanoseconds_ / 1000000);
 }
 
 int64 Time::as_microseconds() const
 {
-    return microseconds_;
+    return nanoseconds_ / 1000;
 }
 
+int64 Time::as_nanoseconds() const
+{
+    return nanoseconds_;
+}
 
 Frequency Time::to_frequency() const {
-    if (microseconds_ == std::numeric_limits<int64>::max())
+    if (nanoseconds_ == std::numeric_limits<int64>::max())
         return Frequency::Zero;
-    if (microseconds_ == 0)
+    if (nanoseconds_ == 0)
         return Frequency::Inf;
-    return megahertz(1.0 / static_cast<double>(microseconds_));
+    return megahertz(1000.0 / static_cast<double>(nanoseconds_));
 }
 
 
@@ -51,14 +55,18 @@ Frequency Time::to_frequency() const {
 //==============================================================================
 
 Time seconds(double amount) {
-    return Time(static_cast<int64>(amount * 1000000));
+    return Time(static_cast<int64>(amount * 1000000000));
 }
 
 Time milliseconds(int32 amount) {
-    return Time(static_cast<int64>(amount) * 1000);
+    return Time(static_cast<int64>(amount) * 1000000);
 }
 
 Time microseconds(int64 amount) {
+    return Time(amount * 1000);
+}
+
+Time nanoseconds(int64 amount) {
     return Time(amount);
 }
 
@@ -71,42 +79,44 @@ std::ostream& operator << (std::ostream& os, const Time& t) {
         os << t.as_seconds() << " s";
     else if (t.as_milliseconds() > 1)
         os << t.as_milliseconds() << " ms";
-    else
+    else if (t.as_microseconds() > 1)
         os << t.as_microseconds() << " us";
+    else
+        os << t.as_nanoseconds() << " ns";
     return os;
 }
 
 
 bool operator ==(Time left, Time right) {
-    return left.as_microseconds() == right.as_microseconds();
+    return left.as_nanoseconds() == right.as_nanoseconds();
 }
 
 bool operator !=(Time left, Time right) {
-    return left.as_microseconds() != right.as_microseconds();
+    return left.as_nanoseconds() != right.as_nanoseconds();
 }
 
 bool operator <(Time left, Time right) {
-    return left.as_microseconds() < right.as_microseconds();
+    return left.as_nanoseconds() < right.as_nanoseconds();
 }
 
 bool operator >(Time left, Time right) {
-    return left.as_microseconds() > right.as_microseconds();
+    return left.as_nanoseconds() > right.as_nanoseconds();
 }
 
 bool operator <=(Time left, Time right) {
-    return left.as_microseconds() <= right.as_microseconds();
+    return left.as_nanoseconds() <= right.as_nanoseconds();
 }
 
 bool operator >=(Time left, Time right) {
-    return left.as_microseconds() >= right.as_microseconds();
+    return left.as_nanoseconds() >= right.as_nanoseconds();
 }
 
 Time operator -(Time right) {
-    return microseconds(-right.as_microseconds());
+    return nanoseconds(-right.as_nanoseconds());
 }
 
 Time operator +(Time left, Time right) {
-    return microseconds(left.as_microseconds() + right.as_microseconds());
+    return nanoseconds(left.as_nanoseconds() + right.as_nanoseconds());
 }
 
 Time& operator +=(Time& left, Time right) {
@@ -114,7 +124,7 @@ Time& operator +=(Time& left, Time right) {
 }
 
 Time operator -(Time left, Time right) {
-    return microseconds(left.as_microseconds() - right.as_microseconds());
+    return nanoseconds(left.as_nanoseconds() - right.as_nanoseconds());
 }
 
 Time& operator -=(Time& left, Time right) {
@@ -122,11 +132,11 @@ Time& operator -=(Time& left, Time right) {
 }
 
 Time operator *(Time left, double right) {
-    return seconds(left.as_seconds() * right);
+    return nanoseconds(static_cast<int64>(left.as_nanoseconds() * right));
 }
 
 Time operator *(Time left, int64 right) {
-    return microseconds(left.as_microseconds() * right);
+    return nanoseconds(left.as_nanoseconds() * right);
 }
 
 Time operator *(double left, Time right) {
@@ -146,11 +156,11 @@ Time& operator *=(Time& left, int64 right) {
 }
 
 Time operator /(Time left, double right) {
-    return seconds(left.as_seconds() / right);
+    return nanoseconds(static_cast<int64>(left.as_nanoseconds() / right));
 }
 
 Time operator /(Time left, int64 right) {
-    return microseconds(left.as_microseconds() / right);
+    return nanoseconds(left.as_nanoseconds() / right);
 }
 
 Time& operator /=(Time& left, double right) {
@@ -162,11 +172,11 @@ Time& operator /=(Time& left, int64 right) {
 }
 
 double operator /(Time left, Time right) {
-    return left.as_seconds() / right.as_seconds();
+    return static_cast<double>(left.as_nanoseconds()) / static_cast<double>(right.as_nanoseconds());
 }
 
 Time operator %(Time left, Time right) {
-    return microseconds(left.as_microseconds() % right.as_microseconds());
+    return nanoseconds(left.as_nanoseconds() % right.as_nanoseconds());
 }
 
 Time& operator %=(Time& left, Time right) {
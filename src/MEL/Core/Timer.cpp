@@ -2,6 +2,11 @@
 #include <MEL/Utility/System.hpp>
 #include <MEL/Core/Console.hpp>
 #include <MEL/Logging/Log.hpp>
+#include <algorithm>
+#ifndef _WIN32
+#include <time.h>
+#include <errno.h>
+#endif
 
 namespace mel {
 
@@ -16,6 +21,42 @@ static void wait_sleep(const Time& duration) {
     sleep(duration);
 }
 
+#if defined(_WIN32) || defined(__APPLE__)
+
+static void wait_sleep_until(const Time& deadline, const Time& now) {
+    // no absolute sleep available, fall back to relative sleep
+    sleep(deadline - now);
+}
+
+#else
+
+static void wait_sleep_until(const Time& deadline, const Time& now) {
+    // Clock runs on CLOCK_MONOTONIC_RAW, which clock_nanosleep does not
+    // accept, so translate the deadline into the CLOCK_MONOTONIC domain
+    timespec target;
+    clock_gettime(CLOCK_MONOTONIC, &target);
+    int64 nsecs = static_cast<int64>(target.tv_sec) * 1000000000 + target.tv_nsec;
+    nsecs += (deadline - now).as_nanoseconds();
+    target.tv_sec  = nsecs / 1000000000;
+    target.tv_nsec = nsecs % 1000000000;
+    // an absolute sleep can simply be restarted if it was interrupted
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &target, NULL) == EINTR) {
+    }
+}
+
+#endif
+
+// returned by the histogram getters before enable_histograms() is called
+static const LatencyHistogram& empty_histogram() {
+    static const LatencyHistogram empty;
+    return empty;
+}
+
+// deep copies an optional histogram
+static std::unique_ptr<LatencyHistogram> clone(const std::unique_ptr<LatencyHistogram>& hist) {
+    return std::unique_ptr<LatencyHistogram>(hist ? new LatencyHistogram(*hist) : nullptr);
+}
+
 Timer::Timer(Frequency frequency, WaitMode mode, bool emit_warnings) :
     Timer(frequency.to_time(), mode, emit_warnings)
 {
@@ -29,8 +70,64 @@ Timer::Timer(Time period, WaitMode mode, bool emit_warnings) :
     misses_(0),
     prev_time_(Clock::get_current_time()),
     rate_(0.01),
-    warnings_(emit_warnings)
+    warnings_(emit_warnings),
+    policy_(CatchUpPolicy::Skip),
+    busy_tail_(Time::Zero),
+    deadline_(prev_time_ + period_),
+    histograms_(false),
+    adaptive_target_(0.001),
+    busy_window_(period * 0.1)
 {
+    if (mode_ == WaitMode::Adaptive)
+        oversleep_hist_.reset(new LatencyHistogram());
+}
+
+Timer::Timer(const Timer& other) :
+    mode_(other.mode_),
+    clock_(other.clock_),
+    period_(other.period_),
+    ticks_(other.ticks_),
+    misses_(other.misses_),
+    prev_time_(other.prev_time_),
+    waited_(other.waited_),
+    rate_(other.rate_),
+    warnings_(other.warnings_),
+    policy_(other.policy_),
+    busy_tail_(other.busy_tail_),
+    deadline_(other.deadline_),
+    histograms_(other.histograms_),
+    lateness_hist_(clone(other.lateness_hist_)),
+    compute_hist_(clone(other.compute_hist_)),
+    period_hist_(clone(other.period_hist_)),
+    adaptive_target_(other.adaptive_target_),
+    busy_window_(other.busy_window_),
+    oversleep_hist_(clone(other.oversleep_hist_))
+{
+}
+
+Timer& Timer::operator=(const Timer& other) {
+    if (this != &other) {
+        mode_            = other.mode_;
+        clock_           = other.clock_;
+        period_          = other.period_;
+        ticks_           = other.ticks_;
+        misses_          = other.misses_;
+        prev_time_       = other.prev_time_;
+        waited_          = other.waited_;
+        rate_            = other.rate_;
+        warnings_        = other.warnings_;
+        policy_          = other.policy_;
+        busy_tail_       = other.busy_tail_;
+        deadline_        = other.deadline_;
+        histograms_      = other.histograms_;
+        lateness_hist_   = clone(other.lateness_hist_);
+        compute_hist_    = clone(other.compute_hist_);
+        period_hist_     = clone(other.period_hist_);
+        adaptive_target_ = other.adaptive_target_;
+        busy_window_     = other.busy_window_;
+        oversleep_hist_  = clone(other.oversleep_hist_);
+    }
+    return *this;
 }
 
 Timer::~Timer() { }
@@ -39,19 +136,31 @@ Time Timer::restart() {
     ticks_  = 0;
     misses_ = 0;
     prev_time_ = Clock::get_current_time();
+    deadline_ = prev_time_ + period_;
     waited_ = Time::Zero;
+    if (lateness_hist_) {
+        lateness_hist_->reset();
+        compute_hist_->reset();
+        period_hist_->reset();
+    }
     return clock_.restart();
 }
 
 Time Timer::wait() {
-    Time remaining_time = period_ - (Clock::get_current_time() - prev_time_);
+    Time now = Clock::get_current_time();
+    if (histograms_)
+        compute_hist_->record(now - prev_time_);
+
+    if (mode_ == WaitMode::Absolute) {
+        wait_absolute(now);
+        return get_elapsed_time();
+    }
+
+    Time deadline = prev_time_ + period_;
+    Time remaining_time = deadline - now;
 
     if (remaining_time < Time::Zero) {
-        misses_++;
-        double miss_rate = get_miss_rate();
-        if (miss_rate >= rate_ && ticks_ > 1000 && warnings_) {
-            LOG(Warning) << "Timer miss rate of " << miss_rate << " exceeded acceptable rate of " << rate_;
-        }
+        count_miss();
     }
     else if (remaining_time > Time::Zero) {
         waited_ += remaining_time;
@@ -61,15 +170,78 @@ Time Timer::wait() {
             wait_sleep(remaining_time);
         else if (mode_ == WaitMode::Hybrid) {
             wait_sleep(remaining_time * 0.9);
-            remaining_time = period_ - (Clock::get_current_time() - prev_time_);
+            remaining_time = deadline - Clock::get_current_time();
             wait_busy(remaining_time);
         }
+        else if (mode_ == WaitMode::Adaptive)
+            wait_adaptive(deadline, now);
     }
+    Time prev_time = prev_time_;
     prev_time_ = Clock::get_current_time();
+    if (histograms_) {
+        lateness_hist_->record(prev_time_ - deadline);
+        period_hist_->record(prev_time_ - prev_time);
+    }
     ticks_++;
     return get_elapsed_time();
 }
 
+void Timer::wait_absolute(Time now) {
+    if (now > deadline_) {
+        if (policy_ == CatchUpPolicy::Skip) {
+            // drop every tick whose deadline has already passed
+            int64 skipped = (now - deadline_).as_nanoseconds() / period_.as_nanoseconds();
+            count_miss(skipped + 1);
+            ticks_    += skipped;
+            deadline_ += period_ * skipped;
+        }
+        else {
+            // run the missed tick now; the next wait() sees the next deadline
+            count_miss();
+        }
+    }
+    else if (now < deadline_) {
+        waited_ += deadline_ - now;
+        if (deadline_ - now > busy_tail_)
+            wait_sleep_until(deadline_ - busy_tail_, now);
+        while (Clock::get_current_time() < deadline_) {
+            // busy wait the tail
+        }
+    }
+    Time prev_time = prev_time_;
+    prev_time_ = Clock::get_current_time();
+    if (histograms_) {
+        lateness_hist_->record(prev_time_ - deadline_);
+        period_hist_->record(prev_time_ - prev_time);
+    }
+    deadline_ += period_;
+    ticks_++;
+}
+
+void Timer::wait_adaptive(Time deadline, Time now) {
+    Time sleep_time = deadline - now - busy_window_;
+    if (sleep_time > Time::Zero) {
+        wait_sleep(sleep_time);
+        oversleep_hist_->record(Clock::get_current_time() - now - sleep_time);
+        // once enough samples exist to resolve the target percentile, size
+        // the busy window to it and start a new measurement window
+        int64 window = std::max(static_cast<int64>(1000), static_cast<int64>(10.0 / adaptive_target_));
+        if (oversleep_hist_->get_count() >= window) {
+            busy_window_ = std::min(oversleep_hist_->get_percentile(100.0 * (1.0 - adaptive_target_)), period_ * 0.5);
+            oversleep_hist_->reset();
+        }
+    }
+    wait_busy(deadline - Clock::get_current_time());
+}
+
+void Timer::count_miss(int64 count) {
+    misses_ += count;
+    double miss_rate = get_miss_rate();
+    if (miss_rate >= rate_ && ticks_ > 1000 && warnings_) {
+        LOG(Warning) << "Timer miss rate of " << miss_rate << " exceeded acceptable rate of " << rate_;
+    }
+}
+
 Time Timer::get_elapsed_time() const {
     return clock_.get_elapsed_time();
 }
@@ -114,4 +286,59 @@ void Timer::disable_warnings() {
     warnings_ = false;
 }
 
+void Timer::set_catch_up_policy(CatchUpPolicy policy) {
+    policy_ = policy;
+}
+
+void Timer::set_busy_tail(Time tail) {
+    busy_tail_ = tail;
+}
+
+void Timer::set_adaptive_target(double miss_rate) {
+    adaptive_target_ = miss_rate > 0.0 ? miss_rate : 0.001;
+    if (oversleep_hist_)
+        oversleep_hist_->reset();
+}
+
+Time Timer::get_busy_window() const {
+    return busy_window_;
+}
+
+void Timer::enable_histograms() {
+    if (!lateness_hist_) {
+        lateness_hist_.reset(new LatencyHistogram());
+        compute_hist_.reset(new LatencyHistogram());
+        period_hist_.reset(new LatencyHistogram());
+    }
+    histograms_ = true;
+}
+
+void Timer::disable_histograms() {
+    histograms_ = false;
+}
+
+const LatencyHistogram& Timer::get_lateness_histogram() const {
+    return lateness_hist_ ? *lateness_hist_ : empty_histogram();
+}
+
+const LatencyHistogram& Timer::get_compute_histogram() const {
+    return compute_hist_ ? *compute_hist_ : empty_histogram();
+}
+
+const LatencyHistogram& Timer::get_period_histogram() const {
+    return period_hist_ ? *period_hist_ : empty_histogram();
+}
+
+Table Timer::get_histogram_table() const {
+    Table table("timer_histograms", {"percentile", "lateness [us]", "compute [us]", "period [us]"});
+    const double percentiles[] = {50.0, 90.0, 99.0, 99.9, 100.0};
+    for (double p : percentiles) {
+        table.push_back_row({p,
+            get_lateness_histogram().get_percentile(p).as_nanoseconds() / 1000.0,
+            get_compute_histogram().get_percentile(p).as_nanoseconds() / 1000.0,
+            get_period_histogram().get_percentile(p).as_nanoseconds() / 1000.0});
+    }
+    return table;
+}
+
 } // namespace mel
@@ -6,7 +6,7 @@
 #include <sys/timeb.h>
 #include <time.h>
 #else
-#include <sys/time.h>
+#include <time.h>
 #endif
 
 namespace mel {
@@ -39,13 +39,14 @@ Timestamp::Timestamp() {
     min      = t.tm_min;
     sec      = t.tm_sec;
     millisec = tb.millitm;
+    nanosec  = tb.millitm * 1000000;
 }
 #else
 Timestamp::Timestamp() {
-    timeval tv;
-    ::gettimeofday(&tv, NULL);
+    timespec ts;
+    ::clock_gettime(CLOCK_REALTIME, &ts);
     tm t;
-    mel::localtime_s(&t, &tv.tv_sec);
+    mel::localtime_s(&t, &ts.tv_sec);
     year     = t.tm_year + 1900;
     month    = t.tm_mon + 1;
     yday     = t.tm_yday + 1;
@@ -54,7 +55,8 @@ Timestamp::Timestamp() {
     hour     = t.tm_hour;
     min      = t.tm_min;
     sec      = t.tm_sec;
-    millisec = static_cast<unsigned short>(tv.tv_usec / 1000);
+    millisec = static_cast<int>(ts.tv_nsec / 1000000);
+    nanosec  = static_cast<int>(ts.tv_nsec);
 }
 #endif
 
@@ -0,0 +1,282 @@
+#include <MEL/Daq/AsyncDaq.hpp>
+#include <MEL/Core/Timer.hpp>
+#include <MEL/Logging/Log.hpp>
+
+namespace mel {
+
+namespace {
+
+template <typename T>
+ChanNums channels_of(Module<T>* module) {
+    return module ? module->get_channel_numbers() : ChanNums();
+}
+
+template <typename T>
+std::vector<T> values_of(Module<T>* module) {
+    return module ? module->get_values() : std::vector<T>();
+}
+
+} // namespace
+
+//==============================================================================
+// ASYNC MODULES
+//==============================================================================
+
+AsyncAI::AsyncAI(AsyncDaq& daq, const ChanNums& channel_numbers) :
+    AnalogInput(channel_numbers),
+    daq_(daq)
+{
+    set_name(daq.get_name() + "_AI");
+}
+
+bool AsyncAI::update_channel(ChanNum channel_number) {
+    daq_.consume_input();
+    return true;
+}
+
+bool AsyncAI::update_channels(const ChanNums& channel_numbers) {
+    daq_.consume_input();
+    return true;
+}
+
+AsyncDI::AsyncDI(AsyncDaq& daq, const ChanNums& channel_numbers) :
+    DigitalInput(channel_numbers),
+    daq_(daq)
+{
+    set_name(daq.get_name() + "_DI");
+}
+
+bool AsyncDI::update_channel(ChanNum channel_number) {
+    daq_.consume_input();
+    return true;
+}
+
+bool AsyncDI::update_channels(const ChanNums& channel_numbers) {
+    daq_.consume_input();
+    return true;
+}
+
+AsyncEncoder::AsyncEncoder(AsyncDaq& daq, const ChanNums& channel_numbers) :
+    Encoder(channel_numbers),
+    daq_(daq)
+{
+    set_name(daq.get_name() + "_encoder");
+}
+
+bool AsyncEncoder::update_channel(ChanNum channel_number) {
+    daq_.consume_input();
+    set_sample_time(daq_.get_input_timestamp());
+    return true;
+}
+
+bool AsyncEncoder::update_channels(const ChanNums& channel_numbers) {
+    daq_.consume_input();
+    set_sample_time(daq_.get_input_timestamp());
+    return true;
+}
+
+bool AsyncEncoder::reset_count(ChanNum channel_number, int count) {
+    LOG(Warning) << "Cannot reset counts of " << get_name() << " while its I/O runs asynchronously";
+    return false;
+}
+
+AsyncAO::AsyncAO(AsyncDaq& daq, const ChanNums& channel_numbers) :
+    AnalogOutput(channel_numbers),
+    daq_(daq)
+{
+    set_name(daq.get_name() + "_AO");
+}
+
+bool AsyncAO::update_channel(ChanNum channel_number) {
+    return daq_.update_output();
+}
+
+bool AsyncAO::update_channels(const ChanNums& channel_numbers) {
+    return daq_.update_output();
+}
+
+AsyncDO::AsyncDO(AsyncDaq& daq, const ChanNums& channel_numbers) :
+    DigitalOutput(channel_numbers),
+    daq_(daq)
+{
+    set_name(daq.get_name() + "_DO");
+}
+
+bool AsyncDO::update_channel(ChanNum channel_number) {
+    return daq_.update_output();
+}
+
+bool AsyncDO::update_channels(const ChanNums& channel_numbers) {
+    return daq_.update_output();
+}
+
+//==============================================================================
+// ASYNC DAQ
+//==============================================================================
+
+AsyncDaq::AsyncDaq(const std::string& name,
+                   DaqBase& daq,
+                   Module<Voltage>* ai,
+                   Module<Logic>* di,
+                   Module<int32>* encoder,
+                   Module<Voltage>* ao,
+                   Module<Logic>* dout,
+                   Frequency io_rate,
+                   int priority) :
+    DaqBase(name),
+    AI(*this, channels_of(ai)),
+    DI(*this, channels_of(di)),
+    encoder(*this, channels_of(encoder)),
+    AO(*this, channels_of(ao)),
+    DO(*this, channels_of(dout)),
+    daq_(daq),
+    ai_(ai),
+    di_(di),
+    encoder_(encoder),
+    ao_(ao),
+    dout_(dout),
+    io_rate_(io_rate),
+    thread_(priority, std::vector<int>(), priority > 0),
+    running_(false),
+    input_timestamp_(Time::Zero),
+    io_cycles_(0),
+    dropped_inputs_(0),
+    dropped_outputs_(0),
+    stale_inputs_(0),
+    output_commands_(0),
+    max_input_age_(Time::Zero)
+{
+}
+
+AsyncDaq::~AsyncDaq() {
+    if (is_enabled())
+        disable();
+    if (is_open())
+        close();
+}
+
+bool AsyncDaq::update_input() {
+    if (!consume_input())
+        ++stale_inputs_;
+    return true;
+}
+
+bool AsyncDaq::update_output() {
+    OutputFrame& out = outputs_.write_buffer();
+    out.ao   = AO.get_values();
+    out.dout = DO.get_values();
+    if (outputs_.publish())
+        ++dropped_outputs_;
+    ++output_commands_;
+    return true;
+}
+
+Time AsyncDaq::get_input_timestamp() const {
+    return input_timestamp_;
+}
+
+Time AsyncDaq::get_input_age() const {
+    return clock_.get_elapsed_time() - input_timestamp_;
+}
+
+AsyncDaq::Stats AsyncDaq::get_stats() const {
+    Stats stats;
+    stats.io_cycles       = io_cycles_;
+    stats.dropped_inputs  = dropped_inputs_;
+    stats.stale_inputs    = stale_inputs_;
+    stats.output_commands = output_commands_;
+    stats.dropped_outputs = dropped_outputs_;
+    stats.max_input_age   = max_input_age_;
+    return stats;
+}
+
+bool AsyncDaq::on_open() {
+    if (!daq_.is_open() && !daq_.open()) {
+        LOG(Error) << "Failed to open " << get_name() << " because the wrapped DAQ failed to open";
+        return false;
+    }
+    clock_.restart();
+    return true;
+}
+
+bool AsyncDaq::on_close() {
+    return daq_.is_open() ? daq_.close() : true;
+}
+
+bool AsyncDaq::on_enable() {
+    if (!daq_.is_enabled() && !daq_.enable()) {
+        LOG(Error) << "Failed to enable " << get_name() << " because the wrapped DAQ failed to enable";
+        return false;
+    }
+    // size every buffer up front so the loops never allocate
+    InputFrame in;
+    in.ai        = values_of(ai_);
+    in.di        = values_of(di_);
+    in.encoder   = values_of(encoder_);
+    in.timestamp = Time::Zero;
+    inputs_.reset(in);
+    OutputFrame out;
+    out.ao   = AO.get_values();
+    out.dout = DO.get_values();
+    outputs_.reset(out);
+    input_timestamp_ = Time::Zero;
+    io_cycles_       = 0;
+    dropped_inputs_  = 0;
+    dropped_outputs_ = 0;
+    stale_inputs_    = 0;
+    output_commands_ = 0;
+    max_input_age_   = Time::Zero;
+    running_ = true;
+    return thread_.start([this]() { io_loop(); });
+}
+
+bool AsyncDaq::on_disable() {
+    running_ = false;
+    thread_.join();
+    return daq_.is_enabled() ? daq_.disable() : true;
+}
+
+bool AsyncDaq::consume_input() {
+    bool fresh = inputs_.update();
+    if (fresh) {
+        const InputFrame& in = inputs_.read_buffer();
+        AI.get_values()      = in.ai;
+        DI.get_values()      = in.di;
+        encoder.get_values() = in.encoder;
+        input_timestamp_     = in.timestamp;
+        encoder.estimate_velocities(input_timestamp_);
+    }
+    Time age = get_input_age();
+    if (age > max_input_age_)
+        max_input_age_ = age;
+    return fresh;
+}
+
+void AsyncDaq::io_loop() {
+    Timer timer(io_rate_, Timer::Absolute);
+    while (running_) {
+        if (outputs_.update()) {
+            const OutputFrame& out = outputs_.read_buffer();
+            if (ao_)
+                ao_->get_values() = out.ao;
+            if (dout_)
+                dout_->get_values() = out.dout;
+            daq_.update_output();
+        }
+        daq_.update_input();
+        InputFrame& in = inputs_.write_buffer();
+        if (ai_)
+            in.ai = ai_->get_values();
+        if (di_)
+            in.di = di_->get_values();
+        if (encoder_)
+            in.encoder = encoder_->get_values();
+        in.timestamp = clock_.get_elapsed_time();
+        if (inputs_.publish())
+            ++dropped_inputs_;
+        ++io_cycles_;
+        timer.wait();
+    }
+}
+
+} // namespace mel
@@ -0,0 +1,56 @@
+#include <MEL/Daq/ChanMap.hpp>
+#include <limits>
+
+namespace mel {
+
+//==============================================================================
+// CLASS DEFINITIONS
+//==============================================================================
+
+const std::size_t ChanMap::npos = std::numeric_limits<std::size_t>::max();
+
+ChanMap::ChanMap() :
+    dense_(true)
+{
+}
+
+ChanMap::ChanMap(const ChanNums& channel_numbers) :
+    numbers_(channel_numbers),
+    dense_(true)
+{
+    if (numbers_.empty())
+        return;
+    ChanNum max_channel = *std::max_element(numbers_.begin(), numbers_.end());
+    // use a direct table unless it would be mostly empty
+    std::size_t table_size = static_cast<std::size_t>(max_channel) + 1;
+    dense_ = table_size <= std::max(static_cast<std::size_t>(64), 4 * numbers_.size());
+    if (dense_) {
+        table_.assign(table_size, npos);
+        for (std::size_t i = 0; i < numbers_.size(); ++i)
+            table_[numbers_[i]] = i;
+    }
+    else {
+        std::vector<std::size_t> order(numbers_.size());
+        for (std::size_t i = 0; i < order.size(); ++i)
+            order[i] = i;
+        std::sort(order.begin(), order.end(), [this](std::size_t a, std::size_t b) {
+            return numbers_[a] < numbers_[b];
+        });
+        keys_.resize(order.size());
+        slots_.resize(order.size());
+        for (std::size_t i = 0; i < order.size(); ++i) {
+            keys_[i]  = numbers_[order[i]];
+            slots_[i] = order[i];
+        }
+    }
+}
+
+const ChanNums& ChanMap::get_channel_numbers() const {
+    return numbers_;
+}
+
+bool ChanMap::is_dense() const {
+    return dense_;
+}
+
+}  // namespace mel
@@ -0,0 +1,25 @@
+#pragma once
+#include <MEL/Core/Types.hpp>
+#include <cstring>
+
+namespace mel {
+
+// Binary layout shared by RecordingDaq and ReplayDaq (native endianness):
+//
+//   char   magic[8]                  "MELDAQ1"
+//   uint32 n_ai, n_di, n_enc         channel counts
+//   uint32 channels[n_ai+n_di+n_enc] channel numbers, in Module order
+//   frames, each:
+//     int64  time                    [ns] since the recording DAQ opened
+//     double ai[n_ai]
+//     uint8  di[n_di]
+//     int32  enc[n_enc]
+
+static const char DAQ_RECORD_MAGIC[8] = {'M','E','L','D','A','Q','1','\0'};
+
+/// Returns the size in bytes of a single frame
+inline std::size_t daq_record_frame_size(std::size_t n_ai, std::size_t n_di, std::size_t n_enc) {
+    return sizeof(int64) + n_ai * sizeof(double) + n_di * sizeof(uint8) + n_enc * sizeof(int32);
+}
+
+} // namespace mel
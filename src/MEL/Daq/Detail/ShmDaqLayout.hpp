@@ -0,0 +1,111 @@
+#pragma once
+#include <MEL/Core/Types.hpp>
+#include <atomic>
+#include <cstring>
+#include <type_traits>
+
+namespace mel {
+
+// Shared memory segment used by ShmDaqServer and ShmDaq (native endianness).
+// The server owns the header and the input block; clients own the output
+// block. Each block is a seqlock: the sequence number is odd while a writer
+// is copying values in, and readers retry until they see the same even
+// number before and after their copy.
+
+static const char SHM_DAQ_MAGIC[8] = {'M','E','L','S','H','M','1','\0'};
+
+static const std::size_t SHM_DAQ_MAX_CHANNELS = 64;
+
+enum ShmDaqModule { ShmAi = 0, ShmDi, ShmEnc, ShmAo, ShmDo, ShmModuleCount };
+
+struct ShmDaqInputBlock {
+    std::atomic<uint32> seq;              ///< seqlock sequence
+    uint32 pad;
+    int64 time;                           ///< [ns] since the server opened
+    double ai[SHM_DAQ_MAX_CHANNELS];
+    uint8  di[SHM_DAQ_MAX_CHANNELS];
+    int32  enc[SHM_DAQ_MAX_CHANNELS];
+};
+
+struct ShmDaqOutputBlock {
+    std::atomic<uint32> seq;              ///< seqlock sequence (CAS-acquired by writers)
+    uint32 pad;
+    double ao[SHM_DAQ_MAX_CHANNELS];
+    uint8  dout[SHM_DAQ_MAX_CHANNELS];
+};
+
+struct ShmDaqSegment {
+    char magic[8];
+    std::atomic<uint32> ready;            ///< 1 once the header is valid
+    uint32 counts[ShmModuleCount];        ///< channel count of each Module
+    uint32 channels[ShmModuleCount][SHM_DAQ_MAX_CHANNELS];
+    alignas(64) ShmDaqInputBlock input;
+    alignas(64) ShmDaqOutputBlock output;
+};
+
+static_assert(ATOMIC_INT_LOCK_FREE == 2, "ShmDaq requires lock-free (address-free) atomics");
+static_assert(std::is_standard_layout<ShmDaqSegment>::value, "ShmDaqSegment must be standard layout");
+
+/// Begins a write by the single writer of a block
+inline void shm_write_begin(std::atomic<uint32>& seq) {
+    seq.store(seq.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+}
+
+/// Spins a seqlock loop gives up after, so a process that died mid-write
+/// cannot stall the others
+static const int SHM_DAQ_MAX_SPINS = 100000;
+
+/// Consecutive server polls that must find the command block held by the
+/// same writer before the server assumes that writer died and reclaims it
+static const int SHM_DAQ_STUCK_POLLS = 1000;
+
+/// Begins a write by one of several writers of a block, spinning while
+/// another writer holds it. On success s is set to the (odd) sequence number
+/// held. Returns false if the block stays held.
+inline bool shm_write_begin_shared(std::atomic<uint32>& seq, uint32& s) {
+    s = seq.load(std::memory_order_relaxed);
+    for (int i = 0; i < SHM_DAQ_MAX_SPINS; ++i) {
+        if (!(s & 1) && seq.compare_exchange_weak(s, s + 1, std::memory_order_acquire, std::memory_order_relaxed)) {
+            std::atomic_thread_fence(std::memory_order_release);
+            s = s + 1;
+            return true;
+        }
+        s = seq.load(std::memory_order_relaxed);
+    }
+    return false;
+}
+
+/// Ends a write begun with shm_write_begin_shared(). Returns false if the
+/// block was reclaimed in the meantime, in which case the write is void.
+inline bool shm_write_end_shared(std::atomic<uint32>& seq, uint32 s) {
+    return seq.compare_exchange_strong(s, s + 1, std::memory_order_release, std::memory_order_relaxed);
+}
+
+/// Ends a write
+inline void shm_write_end(std::atomic<uint32>& seq) {
+    seq.store(seq.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+}
+
+/// Copies a block out of shared memory consistently and sets s to its
+/// sequence number. Makes at most max_tries attempts, each of which fails
+/// without copying if a write is in progress. Returns false if no
+/// consistent copy could be made. copy may run on a torn block, so it must
+/// copy into staging storage that the caller only uses on success.
+template <typename Copy>
+inline bool shm_read(const std::atomic<uint32>& seq, uint32& s, Copy copy, int max_tries = SHM_DAQ_MAX_SPINS) {
+    for (int i = 0; i < max_tries; ++i) {
+        uint32 s0 = seq.load(std::memory_order_acquire);
+        if (s0 & 1)
+            continue;
+        copy();
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (seq.load(std::memory_order_relaxed) == s0) {
+            s = s0;
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace mel
@@ -1,5 +1,7 @@
 #include <MEL/Daq/Encoder.hpp>
 #include <MEL/Logging/Log.hpp>
+#include <cmath>
+#include <cstdint>
 
 namespace mel {
 
@@ -12,7 +14,19 @@ Encoder::Encoder() :
     factors_(this, X4),
     units_per_count_(this, 1.0),
     positions_(this),
-    conversions_(this)
+    conversions_(this),
+    estimators_(this, FixedTime),
+    estimator_params_(this, 0.0),
+    counts_per_sec_(this, 0.0),
+    velocity_estimates_(this, 0.0),
+    last_counts_(this, 0),
+    edge_counts_(this, 0),
+    edge_times_(this, Time::Zero),
+    tracked_offsets_(this, 0.0),
+    last_estimate_time_(Time::Zero),
+    sample_time_(Time::Zero),
+    sample_time_set_(false),
+    estimates_primed_(false)
 {
     compute_conversions();
 }
@@ -22,7 +36,19 @@ Encoder::Encoder(const ChanNums& channel_numbers) :
     factors_(this, X4),
     units_per_count_(this, 1.0),
     positions_(this),
-    conversions_(this)
+    conversions_(this),
+    estimators_(this, FixedTime),
+    estimator_params_(this, 0.0),
+    counts_per_sec_(this, 0.0),
+    velocity_estimates_(this, 0.0),
+    last_counts_(this, 0),
+    edge_counts_(this, 0),
+    edge_times_(this, Time::Zero),
+    tracked_offsets_(this, 0.0),
+    last_estimate_time_(Time::Zero),
+    sample_time_(Time::Zero),
+    sample_time_set_(false),
+    estimates_primed_(false)
 {
     compute_conversions();
 }
@@ -106,6 +132,125 @@ double Encoder::get_position(ChanNum channel_number) {
         return double();
 }
 
+bool Encoder::update() {
+    sample_time_set_ = false;
+    bool success = update_all();
+    estimate_velocities(sample_time_set_ ? sample_time_ : clock_.get_elapsed_time());
+    return success;
+}
+
+bool Encoder::update_all() {
+    return update_channels(get_channel_numbers());
+}
+
+void Encoder::set_velocity_estimator(VelocityEstimator estimator, double parameter) {
+    for (auto const& ch : get_channel_numbers()) {
+        estimators_[ch] = estimator;
+        estimator_params_[ch] = parameter;
+    }
+    reset_velocity_estimates();
+}
+
+void Encoder::set_velocity_estimator(ChanNum channel_number, VelocityEstimator estimator, double parameter) {
+    if (validate_channel_number(channel_number)) {
+        estimators_[channel_number] = estimator;
+        estimator_params_[channel_number] = parameter;
+        reset_velocity_estimates();
+    }
+}
+
+void Encoder::estimate_velocities(Time timestamp) {
+    // all registries share the channel ordering of values_, so one pass over
+    // the raw vectors serves every channel without per-channel lookups
+    const std::vector<int>& counts = values_.get();
+    std::vector<int>& last = last_counts_.get();
+    std::vector<double>& vel = counts_per_sec_.get();
+    const std::size_t n = counts.size();
+    if (!estimates_primed_ || last.size() != n || timestamp < last_estimate_time_) {
+        last = counts;
+        edge_counts_.get() = counts;
+        edge_times_.get().assign(n, timestamp);
+        tracked_offsets_.get().assign(n, 0.0);
+        vel.assign(n, 0.0);
+        last_estimate_time_ = timestamp;
+        estimates_primed_ = true;
+        return;
+    }
+    const double dt = (timestamp - last_estimate_time_).as_seconds();
+    if (dt <= 0.0)
+        return;
+    const std::vector<VelocityEstimator>& est = estimators_.get();
+    const std::vector<double>& param = estimator_params_.get();
+    std::vector<int>& edge_counts = edge_counts_.get();
+    std::vector<Time>& edge_times = edge_times_.get();
+    std::vector<double>& tracked = tracked_offsets_.get();
+    for (std::size_t i = 0; i < n; ++i) {
+        // wrap-safe count difference for 32-bit hardware counters
+        const int delta = static_cast<int32_t>(static_cast<uint32_t>(counts[i]) - static_cast<uint32_t>(last[i]));
+        switch (est[i]) {
+            case FixedTime: {
+                const double raw = delta / dt;
+                const double alpha = param[i] > 0.0 ? dt / (param[i] + dt) : 1.0;
+                vel[i] += alpha * (raw - vel[i]);
+                break;
+            }
+            case FixedPosition: {
+                const int edges = static_cast<int32_t>(static_cast<uint32_t>(counts[i]) - static_cast<uint32_t>(edge_counts[i]));
+                const int min_edges = param[i] > 1.0 ? static_cast<int>(param[i]) : 1;
+                const double since = (timestamp - edge_times[i]).as_seconds();
+                if (std::abs(edges) >= min_edges) {
+                    vel[i] = edges / since;
+                    edge_counts[i] = counts[i];
+                    edge_times[i] = timestamp;
+                }
+                else {
+                    // no new edges: speed can be at most min_edges per elapsed time
+                    const double bound = min_edges / since;
+                    if (std::abs(vel[i]) > bound)
+                        vel[i] = std::copysign(bound, vel[i]);
+                }
+                break;
+            }
+            case TrackingLoop: {
+                // critically damped PI loop on position error (kp = 2w, ki = w^2),
+                // the steady-state Kalman filter for a constant-velocity model
+                const double w = param[i];
+                const double error = delta - tracked[i];
+                vel[i] += w * w * error * dt;
+                tracked[i] += (vel[i] + 2.0 * w * error) * dt - delta;
+                break;
+            }
+        }
+        last[i] = counts[i];
+    }
+    last_estimate_time_ = timestamp;
+}
+
+void Encoder::reset_velocity_estimates() {
+    estimates_primed_ = false;
+    counts_per_sec_.get().assign(get_channel_count(), 0.0);
+}
+
+double Encoder::get_velocity_estimate(ChanNum channel_number) {
+    if (validate_channel_number(channel_number))
+        return counts_per_sec_[channel_number] * conversions_[channel_number];
+    else
+        return double();
+}
+
+const std::vector<double>& Encoder::get_velocity_estimates() {
+    for (auto const& ch : get_channel_numbers())
+        velocity_estimates_[ch] = counts_per_sec_[ch] * conversions_[ch];
+    return velocity_estimates_.get();
+}
+
+Encoder::VelocityChannel Encoder::get_velocity_channel(ChanNum channel_number) {
+    if (validate_channel_number(channel_number))
+        return VelocityChannel(this, channel_number);
+    else
+        return VelocityChannel();
+}
+
 Encoder::Channel Encoder::get_channel(ChanNum channel_number) {
     if (validate_channel_number(channel_number))
         return Channel(this, channel_number);
@@ -135,6 +280,11 @@ void Encoder::compute_conversions() {
     }
 }
 
+void Encoder::set_sample_time(Time timestamp) {
+    sample_time_ = timestamp;
+    sample_time_set_ = true;
+}
+
 //==============================================================================
 // CHANNEL DEFINITIONS
 //==============================================================================
@@ -148,7 +298,11 @@ Encoder::Channel::Channel(Encoder* module, ChanNum channel_number) :
 { }
 
 double Encoder::Channel::get_position() {
-    position_ = static_cast<Encoder*>(module_)->get_position(channel_number_);
+    std::size_t i = get_index();
+    if (i != ChanMap::npos) {
+        Encoder* encoder = static_cast<Encoder*>(module_);
+        position_ = encoder->values_.get()[i] * encoder->conversions_.get()[i];
+    }
     return position_;
 }
 
@@ -168,4 +322,21 @@ void Encoder::Channel::set_units_per_count(double units_per_count) {
     static_cast<Encoder*>(module_)->set_units_per_count(channel_number_, units_per_count);
 }
 
+Encoder::VelocityChannel::VelocityChannel() :
+    ChannelBase()
+{ }
+
+Encoder::VelocityChannel::VelocityChannel(Encoder* module, ChanNum channel_number) :
+    ChannelBase(module, channel_number)
+{ }
+
+double Encoder::VelocityChannel::get_velocity() {
+    std::size_t i = get_index();
+    if (i != ChanMap::npos) {
+        Encoder* encoder = static_cast<Encoder*>(module_);
+        velocity_ = encoder->counts_per_sec_.get()[i] * encoder->conversions_.get()[i];
+    }
+    return velocity_;
+}
+
 } // namespace mel
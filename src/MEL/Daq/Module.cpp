@@ -15,21 +15,17 @@ ChanNums sort_and_reduce_channels(const ChanNums& channels) {
     return sorted_channels;
 }
 
-ChanMap make_channel_map(const ChanNums& channel_numbers) {
-    ChanMap channel_map;
-    for (std::size_t i = 0; i < channel_numbers.size(); ++i)
-        channel_map[channel_numbers[i]] = i;
-    return channel_map;
-}
-
 //==============================================================================
 // CLASS DEFINITIONS
 //==============================================================================
 
-ModuleBase::ModuleBase() { }
+ModuleBase::ModuleBase() :
+    generation_(0)
+{ }
 
 ModuleBase::ModuleBase(const ChanNums& channel_numbers) 
-    : channel_numbers_(channel_numbers)
+    : channel_numbers_(channel_numbers),
+      generation_(0)
 {
     update_map();
 }
@@ -44,13 +40,51 @@ bool ModuleBase::on_disable() {
     return true;
 }
 
-bool ModuleBase::update() {
+bool ModuleBase::update_channels(const ChanNums& channel_numbers) {
     bool success = true;
-    for (auto& ch : channel_numbers_) 
+    for (auto& ch : channel_numbers)
         success = update_channel(ch) ? success : false;
     return success;
 }
 
+bool ModuleBase::update() {
+    return update_channels(channel_numbers_);
+}
+
+int ModuleBase::add_group(const ChanNums& channel_numbers) {
+    for (auto& ch : channel_numbers) {
+        if (!validate_channel_number(ch))
+            return -1;
+    }
+    groups_.push_back(sort_and_reduce_channels(channel_numbers));
+    return static_cast<int>(groups_.size() - 1);
+}
+
+bool ModuleBase::update_group(int group) {
+    if (group < 0 || group >= static_cast<int>(groups_.size())) {
+        LOG(Error) << "Invalid channel group " << group << " on Module " << get_name();
+        return false;
+    }
+    return update_channels(groups_[group]);
+}
+
+const ChanNums& ModuleBase::get_group(int group) const {
+    static const ChanNums empty;
+    if (group < 0 || group >= static_cast<int>(groups_.size())) {
+        LOG(Error) << "Invalid channel group " << group << " on Module " << get_name();
+        return empty;
+    }
+    return groups_[group];
+}
+
+std::size_t ModuleBase::get_group_count() const {
+    return groups_.size();
+}
+
+void ModuleBase::clear_groups() {
+    groups_.clear();
+}
+
 void ModuleBase::set_channel_numbers(const ChanNums& channel_numbers) {
     auto new_channel_numbers = sort_and_reduce_channels(channel_numbers);
     if (new_channel_numbers != channel_numbers_) {
@@ -63,7 +97,7 @@ void ModuleBase::set_channel_numbers(const ChanNums& channel_numbers) {
 void ModuleBase::add_channel_number(ChanNum channel_number) {
     if (!channel_map_.count(channel_number)) {
         channel_numbers_.push_back(channel_number);
-        sort_and_reduce_channels(channel_numbers_);
+        channel_numbers_ = sort_and_reduce_channels(channel_numbers_);
         update_map(); 
         LOG(Verbose) << "Added channel number " << channel_number << " to Module " << get_name();      
     } 
@@ -79,7 +113,12 @@ void ModuleBase::remove_channel_number(ChanNum channel_number) {
 
 void ModuleBase::update_map() {
     ChanMap old_map = channel_map_;
-    channel_map_ = make_channel_map(channel_numbers_);
+    channel_map_ = ChanMap(channel_numbers_);
+    ++generation_;
+    // drop channels from groups that are no longer on this Module
+    for (auto& group : groups_)
+        group.erase(std::remove_if(group.begin(), group.end(),
+            [this](ChanNum ch) { return channel_map_.count(ch) == 0; }), group.end());
     for (std::size_t i = 0; i < registries_.size(); i++)
         registries_[i]->change_channel_numbers(old_map, channel_map_);    
 }
@@ -92,6 +131,14 @@ std::size_t ModuleBase::get_channel_count() const {
     return channel_numbers_.size();
 }
 
+std::size_t ModuleBase::get_channel_index(ChanNum channel_number) const {
+    return channel_map_.find(channel_number);
+}
+
+uint64 ModuleBase::get_generation() const {
+    return generation_;
+}
+
 bool ModuleBase::validate_channel_number(uint32 channel_number, bool quiet) const {
     if (channel_map_.count(channel_number) > 0)
         return true;
@@ -114,8 +161,4 @@ void ModuleBase::add_registry(RegistryBase* registry) {
     registries_.push_back(registry);
 }
 
-std::size_t ModuleBase::index(uint32 channel_number) const {
-    return channel_map_.at(channel_number);
-}
-
 } // namespace mel
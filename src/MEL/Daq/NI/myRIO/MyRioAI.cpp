@@ -60,4 +60,30 @@ bool MyRioAI::update_channel(ChanNum channel_number) {
     }
 }
 
+bool MyRioAI::update_channels(const ChanNums& channel_numbers) {
+    if (!connector_.is_open()) {
+        LOG(Error) << "Failed to update channels because" << connector_.get_name() << " is not open";
+        return false;
+    }
+    const auto& registers = REGISTERS[connector_.type];
+    const auto& weights   = WEIGHTS[connector_.type];
+    const auto& offsets   = OFFSETS[connector_.type];
+    bool is_signed = connector_.type == MyRioConnector::Type::MspC;
+    bool success = true;
+    for (auto& ch : channel_numbers) {
+        uint16_t value = 0;
+        NiFpga_Status status = NiFpga_ReadU16(myrio_session, registers[ch], &value);
+        if (status < 0) {
+            LOG(Error) << "Failed to update " << get_name() << " channel number "  << ch;
+            success = false;
+            continue;
+        }
+        if (is_signed)
+            values_[ch] = (int16_t)value * weights[ch] + offsets[ch];
+        else
+            values_[ch] = value * weights[ch] + offsets[ch];
+    }
+    return success;
+}
+
 }  // namespace mel
@@ -49,6 +49,35 @@ bool MyRioDIO::update_channel(ChanNum channel_number) {
     return true;
 }
 
+bool MyRioDIO::update_channels(const ChanNums& channel_numbers) {
+    // touch each 8-channel register bank at most once per call
+    std::bitset<8> in_bits[2], out_bits[2];
+    bool in_read[2]   = {false, false};
+    bool out_dirty[2] = {false, false};
+    for (auto& ch : channel_numbers) {
+        std::size_t bank = ch / 8;
+        if (directions_[ch] == In) {
+            if (!in_read[bank]) {
+                in_bits[bank] = read_register(ins_[bank]);
+                in_read[bank] = true;
+            }
+            values_[ch] = in_bits[bank][ch % 8] ? High : Low;
+        }
+        else {
+            if (!out_dirty[bank]) {
+                out_bits[bank]  = read_register(outs_[bank]);
+                out_dirty[bank] = true;
+            }
+            out_bits[bank][ch % 8] = values_[ch] == High;
+        }
+    }
+    for (std::size_t bank = 0; bank < 2; ++bank) {
+        if (out_dirty[bank])
+            write_register(outs_[bank], out_bits[bank]);
+    }
+    return true;
+}
+
 bool MyRioDIO::set_direction(ChanNum channel_number, Direction direction) {
     if (!InputOutput::set_direction(channel_number, direction))
         return false;
@@ -21,7 +21,7 @@ QuanserEncoder::QuanserEncoder(QuanserDaq& daq, const ChanNums& channel_numbers,
     set_name(daq.get_name() + "_encoder");
 }
 
-bool QuanserEncoder::update() {
+bool QuanserEncoder::update_all() {
     t_error result;
     result = hil_read_encoder(daq_.handle_, &get_channel_numbers()[0], static_cast<uint32>(get_channel_count()), &values_.get()[0]);
     // velocity
@@ -238,7 +238,12 @@ double QuanserEncoder::Channel::get_value_per_sec() {
 }
 
 double QuanserEncoder::Channel::get_velocity() {
-    velocity_ = static_cast<QuanserEncoder*>(module_)->get_velocity(channel_number_);
+    QuanserEncoder* encoder = static_cast<QuanserEncoder*>(module_);
+    std::size_t i = get_index();
+    if (!encoder->has_velocity_)
+        velocity_ = encoder->get_velocity(channel_number_);
+    else if (i != ChanMap::npos)
+        velocity_ = encoder->values_per_sec_.get()[i] * encoder->conversions_.get()[i];
     return velocity_;
 }
 
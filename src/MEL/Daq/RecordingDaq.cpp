@@ -0,0 +1,201 @@
+#include <MEL/Daq/RecordingDaq.hpp>
+#include <MEL/Core/Timer.hpp>
+#include <MEL/Logging/Log.hpp>
+#include "Detail/DaqRecord.hpp"
+
+namespace mel {
+
+namespace {
+
+// frames are written to disk once this many bytes are buffered
+const std::size_t FLUSH_SIZE = 1 << 20;
+
+// how often the writer thread checks for a handed off buffer
+const Time WRITE_PERIOD = milliseconds(10);
+
+template <typename T>
+std::size_t channel_count(const Module<T>* module) {
+    return module ? module->get_channel_count() : 0;
+}
+
+template <typename T>
+void write_channel_numbers(std::ofstream& file, const Module<T>* module) {
+    if (!module)
+        return;
+    for (auto& ch : module->get_channel_numbers()) {
+        uint32 ch32 = static_cast<uint32>(ch);
+        file.write(reinterpret_cast<const char*>(&ch32), sizeof(uint32));
+    }
+}
+
+} // namespace
+
+//==============================================================================
+// CLASS DEFINITIONS
+//==============================================================================
+
+RecordingDaq::RecordingDaq(const std::string& name,
+                           DaqBase& daq,
+                           const std::string& filepath,
+                           Module<Voltage>* ai,
+                           Module<Logic>* di,
+                           Module<int32>* encoder) :
+    DaqBase(name),
+    daq_(daq),
+    filepath_(filepath),
+    ai_(ai),
+    di_(di),
+    encoder_(encoder),
+    counts_(),
+    pending_full_(false),
+    writing_(false),
+    writer_(0, std::vector<int>(), false),
+    frame_size_(0),
+    frame_count_(0)
+{
+}
+
+RecordingDaq::~RecordingDaq() {
+    if (is_enabled())
+        disable();
+    if (is_open())
+        close();
+}
+
+bool RecordingDaq::update_input() {
+    if (!daq_.update_input())
+        return false;
+    if (!file_.is_open())
+        return true;
+    // frames are sized by the channel counts written to the header at open
+    if (channel_count(ai_) != counts_[0] || channel_count(di_) != counts_[1] || channel_count(encoder_) != counts_[2]) {
+        LOG(Error) << "Cannot record frame of " << daq_.get_name() << " because its channel counts changed since "
+                   << get_name() << " was opened";
+        return false;
+    }
+    std::size_t offset = buffer_.size();
+    buffer_.resize(offset + frame_size_);
+    char* p = &buffer_[offset];
+    int64 t = clock_.get_elapsed_time().as_nanoseconds();
+    std::memcpy(p, &t, sizeof(int64));
+    p += sizeof(int64);
+    if (ai_) {
+        const std::vector<Voltage>& values = ai_->get_values();
+        std::memcpy(p, values.data(), values.size() * sizeof(double));
+        p += values.size() * sizeof(double);
+    }
+    if (di_) {
+        for (auto& value : di_->get_values())
+            *p++ = static_cast<char>(value == High ? 1 : 0);
+    }
+    if (encoder_) {
+        const std::vector<int32>& values = encoder_->get_values();
+        std::memcpy(p, values.data(), values.size() * sizeof(int32));
+    }
+    ++frame_count_;
+    if (buffer_.size() >= FLUSH_SIZE)
+        hand_off();
+    return true;
+}
+
+bool RecordingDaq::update_output() {
+    return daq_.update_output();
+}
+
+std::size_t RecordingDaq::get_frame_count() const {
+    return frame_count_;
+}
+
+bool RecordingDaq::on_open() {
+    if (!daq_.is_open() && !daq_.open()) {
+        LOG(Error) << "Failed to open " << get_name() << " because the wrapped DAQ failed to open";
+        return false;
+    }
+    file_.open(filepath_, std::ios::binary | std::ios::trunc);
+    if (!file_.is_open()) {
+        LOG(Error) << "Failed to open recording file " << filepath_;
+        return false;
+    }
+    counts_[0] = channel_count(ai_);
+    counts_[1] = channel_count(di_);
+    counts_[2] = channel_count(encoder_);
+    uint32 counts[3] = {
+        static_cast<uint32>(counts_[0]),
+        static_cast<uint32>(counts_[1]),
+        static_cast<uint32>(counts_[2])
+    };
+    file_.write(DAQ_RECORD_MAGIC, sizeof(DAQ_RECORD_MAGIC));
+    file_.write(reinterpret_cast<const char*>(counts), sizeof(counts));
+    write_channel_numbers(file_, ai_);
+    write_channel_numbers(file_, di_);
+    write_channel_numbers(file_, encoder_);
+    frame_size_  = daq_record_frame_size(counts[0], counts[1], counts[2]);
+    frame_count_ = 0;
+    buffer_.clear();
+    buffer_.reserve(FLUSH_SIZE + frame_size_);
+    pending_.clear();
+    pending_.reserve(FLUSH_SIZE + frame_size_);
+    pending_full_ = false;
+    writing_ = true;
+    if (!writer_.start([this]() {
+            Timer timer(WRITE_PERIOD, Timer::Sleep);
+            while (writing_) {
+                write_pending();
+                timer.wait();
+            }
+        })) {
+        writing_ = false;
+        file_.close();
+        LOG(Error) << "Failed to start the writer thread of " << get_name();
+        return false;
+    }
+    clock_.restart();
+    LOG(Verbose) << "Recording " << daq_.get_name() << " to " << filepath_;
+    return true;
+}
+
+bool RecordingDaq::on_close() {
+    if (file_.is_open()) {
+        // the writer thread owns file_ until it is joined
+        writing_ = false;
+        writer_.join();
+        write_pending();
+        flush();
+        file_.close();
+        LOG(Verbose) << "Recorded " << frame_count_ << " frames to " << filepath_;
+    }
+    return daq_.is_open() ? daq_.close() : true;
+}
+
+bool RecordingDaq::on_enable() {
+    return daq_.enable();
+}
+
+bool RecordingDaq::on_disable() {
+    return daq_.disable();
+}
+
+void RecordingDaq::hand_off() {
+    // swapping vectors exchanges pointers, so no frames are copied here
+    if (!pending_full_.load(std::memory_order_acquire)) {
+        buffer_.swap(pending_);
+        pending_full_.store(true, std::memory_order_release);
+    }
+}
+
+void RecordingDaq::write_pending() {
+    if (pending_full_.load(std::memory_order_acquire)) {
+        file_.write(pending_.data(), pending_.size());
+        pending_.clear();
+        pending_full_.store(false, std::memory_order_release);
+    }
+}
+
+void RecordingDaq::flush() {
+    if (!buffer_.empty()) {
+        file_.write(buffer_.data(), buffer_.size());
+        buffer_.clear();
+    }
+}
+
+} // namespace mel
@@ -4,14 +4,11 @@
 namespace mel {
 
     RegistryBase::RegistryBase(ModuleBase* module) :
-        module_(module) 
+        module_(module),
+        map_(&module->channel_map_)
     {
         module_->add_registry(this);
     }
 
-    std::size_t RegistryBase::index(ChanNum channel_number) const {
-        return module_->index(channel_number);
-    }
-
 
 } // namespace mel
\ No newline at end of file
@@ -0,0 +1,286 @@
+#include <MEL/Daq/ReplayDaq.hpp>
+#include <MEL/Logging/Log.hpp>
+#include <MEL/Utility/System.hpp>
+#include "Detail/DaqRecord.hpp"
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+
+namespace mel {
+
+//==============================================================================
+// REPLAY AI
+//==============================================================================
+
+ReplayAI::ReplayAI(ReplayDaq& daq) :
+    AnalogInput(),
+    daq_(daq)
+{
+    set_name(daq.get_name() + "_AI");
+}
+
+bool ReplayAI::update_channel(ChanNum channel_number) {
+    int i = ReplayDaq::find(get_channel_numbers(), channel_number);
+    if (!daq_.current_ || i < 0 || !daq_.check_channel_count(*this, daq_.n_ai_))
+        return false;
+    std::memcpy(&values_[channel_number], daq_.current_ + sizeof(int64) + i * sizeof(double), sizeof(double));
+    return true;
+}
+
+bool ReplayAI::update_channels(const ChanNums& channel_numbers) {
+    bool success = true;
+    for (auto& ch : channel_numbers)
+        success = update_channel(ch) ? success : false;
+    return success;
+}
+
+bool ReplayAI::update() {
+    if (!daq_.current_ || !daq_.check_channel_count(*this, daq_.n_ai_))
+        return false;
+    std::memcpy(values_.get().data(), daq_.current_ + sizeof(int64), daq_.n_ai_ * sizeof(double));
+    return true;
+}
+
+//==============================================================================
+// REPLAY DI
+//==============================================================================
+
+ReplayDI::ReplayDI(ReplayDaq& daq) :
+    DigitalInput(),
+    daq_(daq)
+{
+    set_name(daq.get_name() + "_DI");
+}
+
+bool ReplayDI::update_channel(ChanNum channel_number) {
+    int i = ReplayDaq::find(get_channel_numbers(), channel_number);
+    if (!daq_.current_ || i < 0 || !daq_.check_channel_count(*this, daq_.n_di_))
+        return false;
+    const char* block = daq_.current_ + sizeof(int64) + daq_.n_ai_ * sizeof(double);
+    values_[channel_number] = block[i] ? High : Low;
+    return true;
+}
+
+bool ReplayDI::update_channels(const ChanNums& channel_numbers) {
+    bool success = true;
+    for (auto& ch : channel_numbers)
+        success = update_channel(ch) ? success : false;
+    return success;
+}
+
+//==============================================================================
+// REPLAY ENCODER
+//==============================================================================
+
+ReplayEncoder::ReplayEncoder(ReplayDaq& daq) :
+    Encoder(),
+    daq_(daq)
+{
+    set_name(daq.get_name() + "_encoder");
+}
+
+bool ReplayEncoder::update_channel(ChanNum channel_number) {
+    int i = ReplayDaq::find(get_channel_numbers(), channel_number);
+    if (!daq_.current_ || i < 0 || !daq_.check_channel_count(*this, daq_.n_enc_))
+        return false;
+    set_sample_time(daq_.get_time());
+    const char* block = daq_.current_ + sizeof(int64) + daq_.n_ai_ * sizeof(double) + daq_.n_di_;
+    std::memcpy(&values_[channel_number], block + i * sizeof(int32), sizeof(int32));
+    return true;
+}
+
+bool ReplayEncoder::update_channels(const ChanNums& channel_numbers) {
+    bool success = true;
+    for (auto& ch : channel_numbers)
+        success = update_channel(ch) ? success : false;
+    return success;
+}
+
+bool ReplayEncoder::update() {
+    if (!daq_.current_ || !daq_.check_channel_count(*this, daq_.n_enc_))
+        return false;
+    const char* block = daq_.current_ + sizeof(int64) + daq_.n_ai_ * sizeof(double) + daq_.n_di_;
+    std::memcpy(values_.get().data(), block, daq_.n_enc_ * sizeof(int32));
+    estimate_velocities(daq_.get_time());
+    return true;
+}
+
+bool ReplayEncoder::reset_count(ChanNum channel_number, int count) {
+    LOG(Warning) << "Cannot reset counts of " << get_name() << " because it is replaying a recording";
+    return false;
+}
+
+//==============================================================================
+// REPLAY DAQ
+//==============================================================================
+
+ReplayDaq::ReplayDaq(const std::string& name, const std::string& filepath, Pace pace) :
+    DaqBase(name),
+    AI(*this),
+    DI(*this),
+    encoder(*this),
+    pace_(pace),
+    looping_(false),
+    loaded_(false),
+    n_ai_(0),
+    n_di_(0),
+    n_enc_(0),
+    frame_size_(0),
+    frame_count_(0),
+    frame_(0),
+    current_(nullptr),
+    start_time_(Time::Zero)
+{
+    loaded_ = load(filepath);
+}
+
+ReplayDaq::~ReplayDaq() {
+    if (is_enabled())
+        disable();
+    if (is_open())
+        close();
+}
+
+bool ReplayDaq::update_input() {
+    if (!loaded_)
+        return false;
+    if (frame_ >= frame_count_) {
+        if (!looping_ || frame_count_ == 0)
+            return false;
+        rewind();
+    }
+    current_ = &data_[frame_ * frame_size_];
+    if (frame_ == 0)
+        start_time_ = get_time();
+    ++frame_;
+    if (pace_ == Recorded) {
+        Time remaining = (get_time() - start_time_) - clock_.get_elapsed_time();
+        if (remaining > Time::Zero)
+            sleep(remaining);
+    }
+    bool success = AI.update();
+    success = DI.update() && success;
+    success = encoder.update() && success;
+    return success;
+}
+
+bool ReplayDaq::update_output() {
+    return true;
+}
+
+void ReplayDaq::set_pace(Pace pace) {
+    pace_ = pace;
+}
+
+void ReplayDaq::set_looping(bool looping) {
+    looping_ = looping;
+}
+
+void ReplayDaq::rewind() {
+    frame_   = 0;
+    current_ = nullptr;
+    clock_.restart();
+}
+
+bool ReplayDaq::is_loaded() const {
+    return loaded_;
+}
+
+bool ReplayDaq::is_finished() const {
+    return !looping_ && frame_ >= frame_count_;
+}
+
+std::size_t ReplayDaq::get_frame_count() const {
+    return frame_count_;
+}
+
+Time ReplayDaq::get_time() const {
+    if (!current_)
+        return Time::Zero;
+    int64 t;
+    std::memcpy(&t, current_, sizeof(int64));
+    return nanoseconds(t);
+}
+
+bool ReplayDaq::on_open() {
+    if (!loaded_) {
+        LOG(Error) << "Failed to open " << get_name() << " because no recording is loaded";
+        return false;
+    }
+    rewind();
+    return true;
+}
+
+bool ReplayDaq::on_close() {
+    return true;
+}
+
+bool ReplayDaq::on_enable() {
+    return true;
+}
+
+bool ReplayDaq::on_disable() {
+    return true;
+}
+
+bool ReplayDaq::load(const std::string& filepath) {
+    std::ifstream file(filepath, std::ios::binary);
+    if (!file.is_open()) {
+        LOG(Error) << "Failed to open recording file " << filepath;
+        return false;
+    }
+    char magic[sizeof(DAQ_RECORD_MAGIC)];
+    uint32 counts[3];
+    file.read(magic, sizeof(magic));
+    file.read(reinterpret_cast<char*>(counts), sizeof(counts));
+    if (!file || std::memcmp(magic, DAQ_RECORD_MAGIC, sizeof(magic)) != 0) {
+        LOG(Error) << filepath << " is not a MEL DAQ recording";
+        return false;
+    }
+    std::vector<uint32> channels(counts[0] + counts[1] + counts[2]);
+    if (!channels.empty())
+        file.read(reinterpret_cast<char*>(channels.data()), channels.size() * sizeof(uint32));
+    if (!file) {
+        LOG(Error) << "Recording " << filepath << " has a truncated header";
+        return false;
+    }
+    n_ai_  = counts[0];
+    n_di_  = counts[1];
+    n_enc_ = counts[2];
+    auto first = channels.begin();
+    ChanNums ai_chs(first, first + n_ai_);
+    ChanNums di_chs(first + n_ai_, first + n_ai_ + n_di_);
+    ChanNums enc_chs(first + n_ai_ + n_di_, channels.end());
+    AI.set_channel_numbers(ai_chs);
+    DI.set_channel_numbers(di_chs);
+    encoder.set_channel_numbers(enc_chs);
+    // frames are laid out in the recorded Module order, which must match ours
+    if (AI.get_channel_numbers() != ai_chs || DI.get_channel_numbers() != di_chs || encoder.get_channel_numbers() != enc_chs) {
+        LOG(Error) << "Recording " << filepath << " has unsorted or duplicate channel numbers";
+        return false;
+    }
+    data_.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    frame_size_  = daq_record_frame_size(n_ai_, n_di_, n_enc_);
+    frame_count_ = data_.size() / frame_size_;
+    if (data_.size() % frame_size_ != 0)
+        LOG(Warning) << "Recording " << filepath << " ends with a partial frame, which will be ignored";
+    LOG(Verbose) << "Loaded " << frame_count_ << " frames from " << filepath;
+    return true;
+}
+
+bool ReplayDaq::check_channel_count(const ModuleBase& module, std::size_t recorded) const {
+    if (module.get_channel_count() == recorded)
+        return true;
+    LOG(Error) << "Cannot replay " << module.get_name() << " because it has " << module.get_channel_count()
+               << " channels but the recording has " << recorded;
+    return false;
+}
+
+int ReplayDaq::find(const ChanNums& channel_numbers, ChanNum channel_number) {
+    auto it = std::lower_bound(channel_numbers.begin(), channel_numbers.end(), channel_number);
+    if (it == channel_numbers.end() || *it != channel_number)
+        return -1;
+    return static_cast<int>(it - channel_numbers.begin());
+}
+
+} // namespace mel
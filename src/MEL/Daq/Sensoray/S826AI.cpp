@@ -14,20 +14,25 @@ S826AI::S826AI(S826& s826) :
     set_name(s826_.get_name() + "_AI");
 }
 
-bool S826AI::update() {
-    int result;
-    uint remaining = 0xFFFF; // all 16 timeslots
-    do {
+bool S826AI::update_channels(const ChanNums& channel_numbers) {
+    // build a single slotlist covering all requested channels
+    uint remaining = 0;
+    for (auto& c : channel_numbers)
+        remaining |= (1u << c);
+    int result = S826_ERR_OK;
+    while (remaining) {
         uint slotlist = remaining;     // Read all available remaining timeslots.
         result = S826_AdcRead(s826_.board_, adc_buffer_, NULL, &slotlist, 0); // note: tmax=0
         remaining &= ~slotlist;
-    } while (result == S826_ERR_NOTREADY);
-    if (result != S826_ERR_OK) {
+        if (result != S826_ERR_OK && result != S826_ERR_NOTREADY)
+            break;
+    }
+    if (result != S826_ERR_OK && result != S826_ERR_NOTREADY) {
         LOG(Error) << "Failed to update " << get_name() << " (" << S826::get_error_message(result) << ")";
         return false;
     }
     // convert adc buffer to voltages
-    for (auto& c : get_channel_numbers()) {
+    for (auto& c : channel_numbers) {
         int32 slot = adc_buffer_[c];
         std::bitset<16> bits(slot); // get first 16 bits which hold the measured value
         int16 value = static_cast<int16>(bits.to_ulong()); // get signed 16-bit int value
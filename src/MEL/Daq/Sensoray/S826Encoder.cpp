@@ -59,6 +59,37 @@ bool S826Encoder::update_channel(ChanNum channel_number) {
     return true;
 }
 
+bool S826Encoder::update_channels(const ChanNums& channel_numbers) {
+    // latch all counters first so the snapshots are as close in time as possible
+    int result;
+    for (auto& c : channel_numbers) {
+        result = S826_CounterSnapshot(s826_.board_, c);
+        if (result != S826_ERR_OK) {
+            LOG(Error) << "Failed to trigger snapshot on " << get_name() << " channel number " << c << " (" << S826::get_error_message(result) << ")";
+            return false;
+        }
+    }
+    bool success = true;
+    for (auto& c : channel_numbers) {
+        uint32 count;
+        uint32 timestamp;
+        result = S826_CounterSnapshotRead(s826_.board_, c, &count, &timestamp, NULL, 0);
+        if (result != S826_ERR_OK) {
+            LOG(Error) << "Failed to update " << get_name() << " channel number " << c << " (" << S826::get_error_message(result) << ")";
+            success = false;
+            continue;
+        }
+        int32 last_count = values_[c];
+        int32 this_count = static_cast<int32>(count);
+        Time last_time = timestamps_[c];
+        Time this_time = microseconds(timestamp);
+        values_[c] = this_count;
+        timestamps_[c] = this_time;
+        values_per_sec_[c] = static_cast<double>(this_count - last_count) / (this_time - last_time).as_seconds();
+    }
+    return success;
+}
+
 bool S826Encoder::reset_count(ChanNum channel_number, int32 count) {
     uint32 ucount = (uint32)count;
     int result;
@@ -177,7 +208,11 @@ double S826Encoder::Channel::get_value_per_sec() {
 }
 
 double S826Encoder::Channel::get_velocity() {
-    velocity_ = static_cast<S826Encoder*>(module_)->get_velocity(channel_number_);
+    std::size_t i = get_index();
+    if (i != ChanMap::npos) {
+        S826Encoder* encoder = static_cast<S826Encoder*>(module_);
+        velocity_ = encoder->values_per_sec_.get()[i] * encoder->conversions_.get()[i];
+    }
     return velocity_;
 }
 
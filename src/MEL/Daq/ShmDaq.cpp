@@ -0,0 +1,432 @@
+#include <MEL/Daq/ShmDaq.hpp>
+#include <MEL/Communications/SharedMemory.hpp>
+#include <MEL/Logging/Log.hpp>
+#include "Detail/ShmDaqLayout.hpp"
+#include <algorithm>
+
+namespace mel {
+
+namespace {
+
+template <typename T>
+uint32 channel_count(const Module<T>* module) {
+    return module ? static_cast<uint32>(module->get_channel_count()) : 0;
+}
+
+template <typename T>
+void write_channel_numbers(uint32* channels, const Module<T>* module) {
+    if (!module)
+        return;
+    const ChanNums& numbers = module->get_channel_numbers();
+    for (std::size_t i = 0; i < numbers.size(); ++i)
+        channels[i] = static_cast<uint32>(numbers[i]);
+}
+
+/// Number of values to copy between a Module and the segment: the Module's
+/// live channel count, clamped to the count published in the header and to
+/// the block capacity, since channels may be added after open()
+std::size_t copy_count(const ShmDaqSegment* seg, ShmDaqModule module, std::size_t live) {
+    return std::min(live, std::min(static_cast<std::size_t>(seg->counts[module]), SHM_DAQ_MAX_CHANNELS));
+}
+
+ChanNums read_channel_numbers(const ShmDaqSegment* seg, ShmDaqModule module) {
+    return ChanNums(seg->channels[module], seg->channels[module] + seg->counts[module]);
+}
+
+} // namespace
+
+//==============================================================================
+// SHM MODULES
+//==============================================================================
+
+ShmAI::ShmAI(ShmDaq& daq) :
+    AnalogInput(),
+    daq_(daq)
+{
+    set_name(daq.get_name() + "_AI");
+}
+
+bool ShmAI::update_channel(ChanNum channel_number) {
+    return daq_.update_input();
+}
+
+bool ShmAI::update_channels(const ChanNums& channel_numbers) {
+    return daq_.update_input();
+}
+
+ShmDI::ShmDI(ShmDaq& daq) :
+    DigitalInput(),
+    daq_(daq)
+{
+    set_name(daq.get_name() + "_DI");
+}
+
+bool ShmDI::update_channel(ChanNum channel_number) {
+    return daq_.update_input();
+}
+
+bool ShmDI::update_channels(const ChanNums& channel_numbers) {
+    return daq_.update_input();
+}
+
+ShmEncoder::ShmEncoder(ShmDaq& daq) :
+    Encoder(),
+    daq_(daq)
+{
+    set_name(daq.get_name() + "_encoder");
+}
+
+bool ShmEncoder::update_channel(ChanNum channel_number) {
+    bool success = daq_.update_input();
+    set_sample_time(daq_.get_input_timestamp());
+    return success;
+}
+
+bool ShmEncoder::update_channels(const ChanNums& channel_numbers) {
+    bool success = daq_.update_input();
+    set_sample_time(daq_.get_input_timestamp());
+    return success;
+}
+
+bool ShmEncoder::reset_count(ChanNum channel_number, int count) {
+    LOG(Warning) << "Cannot reset counts of " << get_name() << " because it mirrors another process";
+    return false;
+}
+
+ShmAO::ShmAO(ShmDaq& daq) :
+    AnalogOutput(),
+    daq_(daq)
+{
+    set_name(daq.get_name() + "_AO");
+}
+
+bool ShmAO::update_channel(ChanNum channel_number) {
+    return daq_.update_output();
+}
+
+bool ShmAO::update_channels(const ChanNums& channel_numbers) {
+    return daq_.update_output();
+}
+
+ShmDO::ShmDO(ShmDaq& daq) :
+    DigitalOutput(),
+    daq_(daq)
+{
+    set_name(daq.get_name() + "_DO");
+}
+
+bool ShmDO::update_channel(ChanNum channel_number) {
+    return daq_.update_output();
+}
+
+bool ShmDO::update_channels(const ChanNums& channel_numbers) {
+    return daq_.update_output();
+}
+
+//==============================================================================
+// SHM DAQ SERVER
+//==============================================================================
+
+ShmDaqServer::ShmDaqServer(const std::string& name,
+                           DaqBase& daq,
+                           const std::string& segment,
+                           Module<Voltage>* ai,
+                           Module<Logic>* di,
+                           Module<int32>* encoder,
+                           Module<Voltage>* ao,
+                           Module<Logic>* dout) :
+    DaqBase(name),
+    daq_(daq),
+    segment_(segment),
+    ai_(ai),
+    di_(di),
+    encoder_(encoder),
+    ao_(ao),
+    dout_(dout),
+    seg_(nullptr),
+    output_seq_(0),
+    output_commands_(0),
+    stuck_seq_(0),
+    stuck_polls_(0)
+{
+}
+
+ShmDaqServer::~ShmDaqServer() {
+    if (is_enabled())
+        disable();
+    if (is_open())
+        close();
+}
+
+bool ShmDaqServer::update_input() {
+    if (!daq_.update_input())
+        return false;
+    if (!seg_)
+        return true;
+    ShmDaqInputBlock& in = seg_->input;
+    shm_write_begin(in.seq);
+    in.time = clock_.get_elapsed_time().as_nanoseconds();
+    if (ai_)
+        std::memcpy(in.ai, ai_->get_values().data(), copy_count(seg_, ShmAi, ai_->get_channel_count()) * sizeof(double));
+    if (di_) {
+        const std::vector<Logic>& values = di_->get_values();
+        std::size_t n = copy_count(seg_, ShmDi, values.size());
+        for (std::size_t i = 0; i < n; ++i)
+            in.di[i] = values[i] == High ? 1 : 0;
+    }
+    if (encoder_)
+        std::memcpy(in.enc, encoder_->get_values().data(), copy_count(seg_, ShmEnc, encoder_->get_channel_count()) * sizeof(int32));
+    shm_write_end(in.seq);
+    return true;
+}
+
+bool ShmDaqServer::update_output() {
+    if (seg_) {
+        ShmDaqOutputBlock& out = seg_->output;
+        uint32 seq = out.seq.load(std::memory_order_acquire);
+        if (seq & 1) {
+            // a client is writing; never wait for it, but reclaim the block
+            // if the same write stays open for SHM_DAQ_STUCK_POLLS polls
+            if (seq != stuck_seq_) {
+                stuck_seq_   = seq;
+                stuck_polls_ = 0;
+            }
+            if (++stuck_polls_ == SHM_DAQ_STUCK_POLLS) {
+                if (out.seq.compare_exchange_strong(seq, seq + 1, std::memory_order_acq_rel)) {
+                    output_seq_ = seq + 1;  // the abandoned command is incomplete
+                    LOG(Warning) << get_name() << " reclaimed the command block of " << segment_
+                                 << " from a client that stopped mid-write";
+                }
+            }
+        }
+        else if (seq != output_seq_) {
+            std::vector<Voltage>* ao = ao_ ? &ao_->get_values() : nullptr;
+            std::vector<Logic>* dout = dout_ ? &dout_->get_values() : nullptr;
+            std::size_t n_ao = ao ? copy_count(seg_, ShmAo, ao->size()) : 0;
+            std::size_t n_do = dout ? copy_count(seg_, ShmDo, dout->size()) : 0;
+            // one attempt only; a command that races it is applied next update.
+            // stage the copy so a torn command never reaches the outputs
+            double ao_staged[SHM_DAQ_MAX_CHANNELS];
+            uint8 do_staged[SHM_DAQ_MAX_CHANNELS];
+            bool consistent = shm_read(out.seq, output_seq_, [&]() {
+                std::memcpy(ao_staged, out.ao, n_ao * sizeof(double));
+                std::memcpy(do_staged, out.dout, n_do * sizeof(uint8));
+            }, 1);
+            if (consistent) {
+                if (ao)
+                    std::memcpy(ao->data(), ao_staged, n_ao * sizeof(double));
+                for (std::size_t i = 0; i < n_do; ++i)
+                    (*dout)[i] = do_staged[i] ? High : Low;
+                ++output_commands_;
+            }
+        }
+    }
+    return daq_.update_output();
+}
+
+uint64 ShmDaqServer::get_output_commands() const {
+    return output_commands_;
+}
+
+bool ShmDaqServer::on_open() {
+    uint32 counts[ShmModuleCount] = {
+        channel_count(ai_), channel_count(di_), channel_count(encoder_), channel_count(ao_), channel_count(dout_)
+    };
+    for (auto& count : counts) {
+        if (count > SHM_DAQ_MAX_CHANNELS) {
+            LOG(Error) << "Failed to open " << get_name() << " because a Module has more than "
+                       << SHM_DAQ_MAX_CHANNELS << " channels";
+            return false;
+        }
+    }
+    if (!daq_.is_open() && !daq_.open()) {
+        LOG(Error) << "Failed to open " << get_name() << " because the wrapped DAQ failed to open";
+        return false;
+    }
+    shm_.reset(new SharedMemory(segment_, OpenOrCreate, sizeof(ShmDaqSegment)));
+    if (!shm_->is_mapped()) {
+        LOG(Error) << "Failed to open " << get_name() << " because shared memory " << segment_ << " could not be mapped";
+        shm_.reset();
+        return false;
+    }
+    seg_ = static_cast<ShmDaqSegment*>(shm_->get_address());
+    // invalidate the header while it is rewritten for clients that attach now
+    seg_->ready.store(0, std::memory_order_release);
+    std::memcpy(seg_->counts, counts, sizeof(counts));
+    write_channel_numbers(seg_->channels[ShmAi], ai_);
+    write_channel_numbers(seg_->channels[ShmDi], di_);
+    write_channel_numbers(seg_->channels[ShmEnc], encoder_);
+    write_channel_numbers(seg_->channels[ShmAo], ao_);
+    write_channel_numbers(seg_->channels[ShmDo], dout_);
+    std::memcpy(seg_->magic, SHM_DAQ_MAGIC, sizeof(SHM_DAQ_MAGIC));
+    output_seq_ = seg_->output.seq.load(std::memory_order_acquire);
+    output_commands_ = 0;
+    stuck_polls_ = 0;
+    clock_.restart();
+    seg_->ready.store(1, std::memory_order_release);
+    return true;
+}
+
+bool ShmDaqServer::on_close() {
+    if (seg_)
+        seg_->ready.store(0, std::memory_order_release);
+    seg_ = nullptr;
+    shm_.reset();
+    return daq_.is_open() ? daq_.close() : true;
+}
+
+bool ShmDaqServer::on_enable() {
+    return daq_.enable();
+}
+
+bool ShmDaqServer::on_disable() {
+    return daq_.disable();
+}
+
+//==============================================================================
+// SHM DAQ
+//==============================================================================
+
+ShmDaq::ShmDaq(const std::string& name, const std::string& segment) :
+    DaqBase(name),
+    AI(*this),
+    DI(*this),
+    encoder(*this),
+    AO(*this),
+    DO(*this),
+    segment_(segment),
+    seg_(nullptr),
+    input_seq_(0),
+    input_timestamp_(Time::Zero),
+    stale_inputs_(0),
+    command_blocked_(false)
+{
+}
+
+ShmDaq::~ShmDaq() {
+    if (is_enabled())
+        disable();
+    if (is_open())
+        close();
+}
+
+bool ShmDaq::update_input() {
+    if (!seg_)
+        return false;
+    ShmDaqInputBlock& in = seg_->input;
+    if (in.seq.load(std::memory_order_acquire) == input_seq_) {
+        ++stale_inputs_;
+        return true;
+    }
+    std::vector<Voltage>& ai = AI.get_values();
+    std::vector<Logic>& di = DI.get_values();
+    std::vector<int32>& enc = encoder.get_values();
+    std::size_t n_ai = copy_count(seg_, ShmAi, ai.size());
+    std::size_t n_di = copy_count(seg_, ShmDi, di.size());
+    std::size_t n_enc = copy_count(seg_, ShmEnc, enc.size());
+    // stage the copy so a torn snapshot never reaches the Modules
+    int64 time = 0;
+    double ai_staged[SHM_DAQ_MAX_CHANNELS];
+    uint8 di_staged[SHM_DAQ_MAX_CHANNELS];
+    int32 enc_staged[SHM_DAQ_MAX_CHANNELS];
+    bool consistent = shm_read(in.seq, input_seq_, [&]() {
+        time = in.time;
+        std::memcpy(ai_staged, in.ai, n_ai * sizeof(double));
+        std::memcpy(di_staged, in.di, n_di * sizeof(uint8));
+        std::memcpy(enc_staged, in.enc, n_enc * sizeof(int32));
+    });
+    if (!consistent) {
+        LOG(Warning) << get_name() << " could not read a consistent input snapshot";
+        return false;
+    }
+    std::memcpy(ai.data(), ai_staged, n_ai * sizeof(double));
+    for (std::size_t i = 0; i < n_di; ++i)
+        di[i] = di_staged[i] ? High : Low;
+    std::memcpy(enc.data(), enc_staged, n_enc * sizeof(int32));
+    input_timestamp_ = nanoseconds(time);
+    encoder.estimate_velocities(input_timestamp_);
+    return true;
+}
+
+bool ShmDaq::update_output() {
+    if (!seg_)
+        return false;
+    ShmDaqOutputBlock& out = seg_->output;
+    uint32 seq;
+    if (!shm_write_begin_shared(out.seq, seq)) {
+        // logged once per blocked run until the server reclaims the block
+        if (!command_blocked_)
+            LOG(Error) << get_name() << " could not acquire the command block of " << segment_;
+        command_blocked_ = true;
+        return false;
+    }
+    command_blocked_ = false;
+    std::memcpy(out.ao, AO.get_values().data(), copy_count(seg_, ShmAo, AO.get_channel_count()) * sizeof(double));
+    const std::vector<Logic>& dout = DO.get_values();
+    std::size_t n_do = copy_count(seg_, ShmDo, dout.size());
+    for (std::size_t i = 0; i < n_do; ++i)
+        out.dout[i] = dout[i] == High ? 1 : 0;
+    if (!shm_write_end_shared(out.seq, seq)) {
+        LOG(Warning) << get_name() << " command was discarded because the server reclaimed the command block";
+        return false;
+    }
+    return true;
+}
+
+Time ShmDaq::get_input_timestamp() const {
+    return input_timestamp_;
+}
+
+uint64 ShmDaq::get_stale_inputs() const {
+    return stale_inputs_;
+}
+
+bool ShmDaq::on_open() {
+    shm_.reset(new SharedMemory(segment_, OpenOnly, sizeof(ShmDaqSegment)));
+    if (!shm_->is_mapped()) {
+        LOG(Error) << "Failed to open " << get_name() << " because shared memory " << segment_ << " does not exist";
+        shm_.reset();
+        return false;
+    }
+    ShmDaqSegment* seg = static_cast<ShmDaqSegment*>(shm_->get_address());
+    if (seg->ready.load(std::memory_order_acquire) != 1 || std::memcmp(seg->magic, SHM_DAQ_MAGIC, sizeof(SHM_DAQ_MAGIC)) != 0) {
+        LOG(Error) << "Failed to open " << get_name() << " because no ShmDaqServer is serving " << segment_;
+        shm_.reset();
+        return false;
+    }
+    AI.set_channel_numbers(read_channel_numbers(seg, ShmAi));
+    DI.set_channel_numbers(read_channel_numbers(seg, ShmDi));
+    encoder.set_channel_numbers(read_channel_numbers(seg, ShmEnc));
+    AO.set_channel_numbers(read_channel_numbers(seg, ShmAo));
+    DO.set_channel_numbers(read_channel_numbers(seg, ShmDo));
+    seg_ = seg;
+    input_seq_ = 0;
+    stale_inputs_ = 0;
+    return true;
+}
+
+bool ShmDaq::on_close() {
+    seg_ = nullptr;
+    shm_.reset();
+    return true;
+}
+
+bool ShmDaq::on_enable() {
+    AI.enable();
+    DI.enable();
+    encoder.enable();
+    return true;
+}
+
+bool ShmDaq::on_disable() {
+    AI.disable();
+    DI.disable();
+    encoder.disable();
+    if (AO.is_enabled())
+        AO.disable();
+    if (DO.is_enabled())
+        DO.disable();
+    return true;
+}
+
+} // namespace mel
@@ -0,0 +1,133 @@
+#include <MEL/Daq/SoftwareWatchdog.hpp>
+#include <MEL/Core/Timer.hpp>
+#include <MEL/Logging/Log.hpp>
+
+namespace mel {
+
+//==============================================================================
+// CLASS DEFINITIONS
+//==============================================================================
+
+SoftwareWatchdog::SoftwareWatchdog(Time timeout, Callback on_expire, int priority, Time poll_period) :
+    Watchdog(timeout),
+    on_expire_(on_expire),
+    poll_ns_((poll_period > Time::Zero ? poll_period : timeout / 10.0).as_nanoseconds()),
+    auto_poll_(poll_period <= Time::Zero),
+    thread_(priority, std::vector<int>(), priority > 0),
+    running_(false),
+    expired_(false),
+    timeout_ns_(timeout.as_nanoseconds()),
+    last_kick_ns_(0),
+    max_interval_ns_(0),
+    expirations_(0)
+{
+}
+
+SoftwareWatchdog::~SoftwareWatchdog() {
+    if (watching_)
+        stop();
+}
+
+bool SoftwareWatchdog::start() {
+    if (watching_) {
+        LOG(Warning) << "SoftwareWatchdog already started";
+        return false;
+    }
+    if (poll_ns_ <= 0) {
+        LOG(Error) << "SoftwareWatchdog timeout must be positive";
+        return false;
+    }
+    expired_ = false;
+    last_kick_ns_ = clock_.get_elapsed_time().as_nanoseconds();
+    running_ = true;
+    if (!thread_.start([this]() { watch(); })) {
+        running_ = false;
+        return false;
+    }
+    watching_ = true;
+    return true;
+}
+
+bool SoftwareWatchdog::kick() {
+    if (!watching_)
+        return start();
+    last_kick_ns_.store(clock_.get_elapsed_time().as_nanoseconds(), std::memory_order_release);
+    return !expired_.load(std::memory_order_relaxed);
+}
+
+bool SoftwareWatchdog::stop() {
+    if (!watching_)
+        return true;
+    running_ = false;
+    thread_.join();
+    watching_ = false;
+    return true;
+}
+
+bool SoftwareWatchdog::is_expired() {
+    return expired_;
+}
+
+bool SoftwareWatchdog::clear() {
+    last_kick_ns_ = clock_.get_elapsed_time().as_nanoseconds();
+    expired_ = false;
+    return true;
+}
+
+void SoftwareWatchdog::set_timeout(Time timeout) {
+    Watchdog::set_timeout(timeout);
+    timeout_ns_ = timeout.as_nanoseconds();
+    if (auto_poll_ && timeout > Time::Zero)
+        poll_ns_ = (timeout / 10.0).as_nanoseconds();
+}
+
+void SoftwareWatchdog::set_expire_callback(Callback on_expire) {
+    on_expire_ = on_expire;
+}
+
+Time SoftwareWatchdog::get_min_margin() const {
+    return nanoseconds(timeout_ns_ - max_interval_ns_);
+}
+
+Time SoftwareWatchdog::get_max_kick_interval() const {
+    return nanoseconds(max_interval_ns_);
+}
+
+uint64 SoftwareWatchdog::get_expirations() const {
+    return expirations_;
+}
+
+void SoftwareWatchdog::reset_stats() {
+    max_interval_ns_ = 0;
+    expirations_ = 0;
+}
+
+void SoftwareWatchdog::watch() {
+    while (running_) {
+        // restarted with the new poll period whenever set_timeout() changes it
+        int64 poll_ns = poll_ns_;
+        Timer timer(nanoseconds(poll_ns), Timer::Absolute);
+        while (running_ && poll_ns == poll_ns_) {
+            poll();
+            timer.wait();
+        }
+    }
+}
+
+void SoftwareWatchdog::poll() {
+    int64 now = clock_.get_elapsed_time().as_nanoseconds();
+    int64 interval = now - last_kick_ns_.load(std::memory_order_acquire);
+    if (!expired_) {
+        if (interval > timeout_ns_) {
+            expired_ = true;
+            ++expirations_;
+            if (on_expire_)
+                on_expire_();
+        }
+        else if (interval > max_interval_ns_) {
+            max_interval_ns_ = interval;
+        }
+    }
+}
+
+} // namespace mel
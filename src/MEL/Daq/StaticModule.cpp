@@ -0,0 +1,15 @@
+#include <MEL/Daq/StaticModule.hpp>
+#include <MEL/Logging/Log.hpp>
+
+namespace mel {
+
+namespace detail {
+
+void warn_static_channel_numbers(const ModuleBase& module, const char* function) {
+    LOG(Warning) << "Ignored " << function << "() on Module " << module.get_name()
+                 << " because its channel numbers [" << module.get_channel_numbers() << "] are fixed at compile time";
+}
+
+} // namespace detail
+
+} // namespace mel
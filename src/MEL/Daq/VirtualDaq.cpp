@@ -5,6 +5,56 @@
 
 namespace mel {
 
+/// Samples the sources of a Module at Time t. A vector source always fills
+/// every channel; it writes values in place when all channels are requested
+/// (channel_numbers is nullptr) and goes through buffer for subsets.
+template <typename T, typename VectorSource, typename Sources>
+static bool sample_sources(const ModuleBase& module,
+                           Registry<T>& values,
+                           Registry<T>& buffer,
+                           const VectorSource& vector_source,
+                           Sources& sources,
+                           Time t,
+                           const ChanNums* channel_numbers)
+{
+    if (vector_source) {
+        std::vector<T>& out = channel_numbers ? buffer.get() : values.get();
+        vector_source(t, out);
+        if (out.size() != module.get_channel_count()) {
+            LOG(Error) << "Vector source of " << module.get_name() << " produced " << out.size() << " values for " << module.get_channel_count() << " channels";
+            out.resize(module.get_channel_count());
+            return false;
+        }
+        if (channel_numbers) {
+            for (auto& ch : *channel_numbers)
+                values[ch] = buffer[ch];
+        }
+    }
+    else {
+        for (auto& ch : channel_numbers ? *channel_numbers : module.get_channel_numbers())
+            values[ch] = sources[ch](t);
+    }
+    return true;
+}
+
+/// Copies a Module's plant measurements, taken for all of its channels in
+/// channel order, into the values of the given channels, or all channels if
+/// channel_numbers is nullptr
+template <typename T>
+static bool copy_measurements(const ModuleBase& module,
+                              Registry<T>& values,
+                              const std::vector<T>& measured,
+                              const ChanNums* channel_numbers)
+{
+    if (!channel_numbers) {
+        values.get() = measured;
+        return true;
+    }
+    for (auto& ch : *channel_numbers)
+        values[ch] = measured[module.get_channel_index(ch)];
+    return true;
+}
+
 //==============================================================================
 // VIRTUAL AI
 //==============================================================================
@@ -16,16 +66,92 @@ static Voltage DEFAULT_AI_SOURCE(Time t) {
 VirtualAI::VirtualAI(VirtualDaq& daq, const ChanNums& channel_numbers) :
     AnalogInput(channel_numbers),
     sources(this, DEFAULT_AI_SOURCE),
-    daq_(daq)
+    daq_(daq),
+    buffer_(this),
+    stream_start_(Time::Zero),
+    stream_scans_(0)
 {
     set_name(daq.get_name() + "_AI");
 }
 
 bool VirtualAI::update_channel(ChanNum channel_number) {
-    values_[channel_number] = sources[channel_number](daq_.clock_.get_elapsed_time());
+    if (vector_source_ || daq_.plant_) {
+        ChanNums channel_numbers(1, channel_number);
+        return sample(daq_.get_time(), &channel_numbers);
+    }
+    values_[channel_number] = sources[channel_number](daq_.get_time());
+    return true;
+}
+
+bool VirtualAI::update_channels(const ChanNums& channel_numbers) {
+    return sample(daq_.get_time(), &channel_numbers);
+}
+
+bool VirtualAI::update() {
+    return sample(daq_.get_time());
+}
+
+void VirtualAI::set_vector_source(VectorSource source) {
+    vector_source_ = source;
+}
+
+void VirtualAI::clear_vector_source() {
+    vector_source_ = nullptr;
+}
+
+bool VirtualAI::sample(Time t, const ChanNums* channel_numbers) {
+    if (daq_.plant_) {
+        daq_.measure_plant();
+        return copy_measurements(*this, values_, daq_.plant_ai_, channel_numbers);
+    }
+    return sample_sources(*this, values_, buffer_, vector_source_, sources, t, channel_numbers);
+}
+
+bool VirtualAI::on_start_stream(Frequency /*sample_rate*/) {
+    stream_start_ = daq_.get_time();
+    stream_scans_ = 0;
+    scan_.resize(get_channel_count());
     return true;
 }
 
+void VirtualAI::on_read_stream() {
+    // produce every scan a clocked ADC would have converted since the last read
+    int64 hz = get_stream_rate().as_hertz();
+    Time now = daq_.get_time();
+    uint64 due = static_cast<uint64>((now - stream_start_).as_seconds() * hz);
+    if (due <= stream_scans_)
+        return;
+    // scans older than the buffer can hold would be dropped anyway
+    uint64 capacity = get_stream_capacity();
+    if (due - stream_scans_ > capacity) {
+        add_stream_overruns(due - stream_scans_ - capacity);
+        stream_scans_ = due - capacity;
+    }
+    // the plant is only observable at its current state; it is measured into
+    // scratch so that reading the stream leaves every Module's values alone
+    if (daq_.plant_)
+        daq_.measure_plant();
+    for (uint64 k = stream_scans_; k < due; ++k) {
+        Time t = stream_start_ + nanoseconds(static_cast<int64>(k * 1000000000 / hz));
+        if (daq_.plant_)
+            scan_ = daq_.plant_ai_;
+        else
+            evaluate_scan(t, scan_);
+        push_scan(scan_.data());
+    }
+    stream_scans_ = due;
+}
+
+void VirtualAI::evaluate_scan(Time t, std::vector<Voltage>& scan) {
+    if (vector_source_) {
+        vector_source_(t, scan);
+        return;
+    }
+    const ChanNums& chs = get_channel_numbers();
+    for (std::size_t i = 0; i < chs.size(); ++i)
+        scan[i] = sources[chs[i]](t);
+}
+
 //==============================================================================
 // VIRUTAL AO
 //==============================================================================
@@ -41,6 +167,10 @@ bool VirtualAO::update_channel(ChanNum channel_number) {
     return true;
 }
 
+bool VirtualAO::update_channels(const ChanNums& channel_numbers) {
+    return true;
+}
+
 //==============================================================================
 // VIRTUAL DI
 //==============================================================================
@@ -55,16 +185,45 @@ static Logic DEFAULT_DI_SOURCE(Time t) {
 VirtualDI::VirtualDI(VirtualDaq& daq, const ChanNums& channel_numbers) :
     DigitalInput(channel_numbers),
     sources(this, DEFAULT_DI_SOURCE),
-    daq_(daq)
+    daq_(daq),
+    buffer_(this)
 {
     set_name(daq.get_name() + "_DI");
 }
 
 bool VirtualDI::update_channel(ChanNum channel_number) {
-    values_[channel_number] = sources[channel_number](daq_.clock_.get_elapsed_time());
+    if (vector_source_ || daq_.plant_) {
+        ChanNums channel_numbers(1, channel_number);
+        return sample(daq_.get_time(), &channel_numbers);
+    }
+    values_[channel_number] = sources[channel_number](daq_.get_time());
     return true;
 }
 
+bool VirtualDI::update_channels(const ChanNums& channel_numbers) {
+    return sample(daq_.get_time(), &channel_numbers);
+}
+
+bool VirtualDI::update() {
+    return sample(daq_.get_time());
+}
+
+void VirtualDI::set_vector_source(VectorSource source) {
+    vector_source_ = source;
+}
+
+void VirtualDI::clear_vector_source() {
+    vector_source_ = nullptr;
+}
+
+bool VirtualDI::sample(Time t, const ChanNums* channel_numbers) {
+    if (daq_.plant_) {
+        daq_.measure_plant();
+        return copy_measurements(*this, values_, daq_.plant_di_, channel_numbers);
+    }
+    return sample_sources(*this, values_, buffer_, vector_source_, sources, t, channel_numbers);
+}
+
 //==============================================================================
 // VIRTUAL DO
 //==============================================================================
@@ -80,6 +239,10 @@ bool VirtualDO::update_channel(ChanNum channel_number) {
     return true;
 }
 
+bool VirtualDO::update_channels(const ChanNums& channel_numbers) {
+    return true;
+}
+
 //==============================================================================
 // VIRTUAL ENCODER
 //==============================================================================
@@ -91,16 +254,49 @@ int32 DEFAULT_ENCODER_SOURCE(Time t) {
 VirtualEncoder::VirtualEncoder(VirtualDaq& daq, const ChanNums& channel_numbers) :
     Encoder(channel_numbers),
     sources(this, DEFAULT_ENCODER_SOURCE),
-    daq_(daq)
+    daq_(daq),
+    buffer_(this)
 {
     set_name(daq.get_name() + "_encoder");
 }
 
 bool VirtualEncoder::update_channel(ChanNum channel_number) {
-    values_[channel_number] = sources[channel_number](daq_.clock_.get_elapsed_time());
+    if (vector_source_ || daq_.plant_) {
+        ChanNums channel_numbers(1, channel_number);
+        return sample(daq_.get_time(), &channel_numbers);
+    }
+    values_[channel_number] = sources[channel_number](daq_.get_time());
     return true;
 }
 
+bool VirtualEncoder::update_channels(const ChanNums& channel_numbers) {
+    return sample(daq_.get_time(), &channel_numbers);
+}
+
+bool VirtualEncoder::update() {
+    Time t = daq_.get_time();
+    bool success = sample(t);
+    estimate_velocities(t);
+    return success;
+}
+
+void VirtualEncoder::set_vector_source(VectorSource source) {
+    vector_source_ = source;
+}
+
+void VirtualEncoder::clear_vector_source() {
+    vector_source_ = nullptr;
+}
+
+bool VirtualEncoder::sample(Time t, const ChanNums* channel_numbers) {
+    set_sample_time(t);
+    if (daq_.plant_) {
+        daq_.measure_plant();
+        return copy_measurements(*this, values_, daq_.plant_encoder_, channel_numbers);
+    }
+    return sample_sources(*this, values_, buffer_, vector_source_, sources, t, channel_numbers);
+}
+
 bool VirtualEncoder::reset_count(ChanNum channel_number, int count) {
     return true;
 }
@@ -116,7 +312,10 @@ VirtualDaq::VirtualDaq(const std::string& name)
       AO(*this, {0,1,2,3,4,5,6,7,8}),
       DI(*this, {0,1,2,3,4,5,6,7,8}),
       DO(*this, {0,1,2,3,4,5,6,7,8}),
-      encoder(*this, {0,1,2,3,4,5,6,7,8})
+      encoder(*this, {0,1,2,3,4,5,6,7,8}),
+      plant_(nullptr),
+      step_(milliseconds(1)),
+      sim_time_(Time::Zero)
 {
 
 }
@@ -147,20 +346,49 @@ bool VirtualDaq::on_disable() {
 }
 
 bool VirtualDaq::update_input() {
-    AI.update();
-    DI.update();
-    encoder.update();
+    // sample every input against the same timestamp
+    Time t = get_time();
+    if (plant_)
+        plant_->measure(AI.get_values(), DI.get_values(), encoder.get_values());
+    else {
+        AI.sample(t);
+        DI.sample(t);
+        encoder.sample(t);
+    }
+    encoder.estimate_velocities(t);
     return true;
 }
 
 bool VirtualDaq::update_output() {
     AO.update();
     DO.update();
+    if (plant_) {
+        plant_->step(step_, AO.get_values(), DO.get_values());
+        sim_time_ += step_;
+    }
     return true;
 }
 
+void VirtualDaq::set_plant(VirtualPlant* plant, Time step) {
+    plant_    = plant;
+    step_     = step;
+    sim_time_ = Time::Zero;
+}
+
+Time VirtualDaq::get_time() const {
+    return plant_ ? sim_time_ : clock_.get_elapsed_time();
+}
+
+void VirtualDaq::measure_plant() {
+    plant_ai_.resize(AI.get_channel_count());
+    plant_di_.resize(DI.get_channel_count());
+    plant_encoder_.resize(encoder.get_channel_count());
+    plant_->measure(plant_ai_, plant_di_, plant_encoder_);
+}
+
 bool VirtualDaq::on_open() {
     clock_.restart();
+    sim_time_ = Time::Zero;
     return true;
 }
 
@@ -0,0 +1,88 @@
+#include <MEL/Daq/VirtualPlant.hpp>
+#include <MEL/Logging/Log.hpp>
+#include <cmath>
+
+namespace mel {
+
+//==============================================================================
+// CLASS DEFINITIONS
+//==============================================================================
+
+LinearPlant::LinearPlant(const Matrix& A, const Matrix& B, const Matrix& C, const Matrix& D) :
+    nx_(A.size()),
+    nu_(B.empty() ? 0 : B[0].size()),
+    ny_(C.size()),
+    x_(A.size(), 0.0),
+    u_(B.empty() ? 0 : B[0].size(), 0.0),
+    xn_(A.size(), 0.0)
+{
+    bool valid = flatten(A, nx_, nx_, A_) &&
+                 flatten(B, nx_, nu_, B_) &&
+                 flatten(C, ny_, nx_, C_);
+    if (D.empty())
+        D_.assign(ny_ * nu_, 0.0);
+    else
+        valid = flatten(D, ny_, nu_, D_) && valid;
+    if (!valid) {
+        LOG(Error) << "Inconsistent LinearPlant matrix dimensions (nx=" << nx_ << ", nu=" << nu_ << ", ny=" << ny_ << ")";
+        nx_ = nu_ = ny_ = 0;
+        A_.clear(); B_.clear(); C_.clear(); D_.clear();
+        x_.clear(); u_.clear(); xn_.clear();
+    }
+}
+
+void LinearPlant::step(Time /*dt*/, const std::vector<Voltage>& ao, const std::vector<Logic>& /*dout*/) {
+    for (std::size_t j = 0; j < nu_; ++j)
+        u_[j] = j < ao.size() ? ao[j] : 0.0;
+    for (std::size_t i = 0; i < nx_; ++i) {
+        double sum = 0.0;
+        for (std::size_t j = 0; j < nx_; ++j)
+            sum += A_[i * nx_ + j] * x_[j];
+        for (std::size_t j = 0; j < nu_; ++j)
+            sum += B_[i * nu_ + j] * u_[j];
+        xn_[i] = sum;
+    }
+    x_.swap(xn_);
+}
+
+void LinearPlant::measure(std::vector<Voltage>& ai, std::vector<Logic>& /*di*/, std::vector<int32>& encoder) {
+    for (std::size_t i = 0; i < ny_; ++i) {
+        double y = 0.0;
+        for (std::size_t j = 0; j < nx_; ++j)
+            y += C_[i * nx_ + j] * x_[j];
+        for (std::size_t j = 0; j < nu_; ++j)
+            y += D_[i * nu_ + j] * u_[j];
+        if (i < ai.size())
+            ai[i] = y;
+        else if (i - ai.size() < encoder.size())
+            encoder[i - ai.size()] = static_cast<int32>(std::lround(y));
+    }
+}
+
+bool LinearPlant::set_state(const std::vector<double>& x) {
+    if (x.size() != nx_) {
+        LOG(Error) << "LinearPlant state size " << x.size() << " does not match nx=" << nx_;
+        return false;
+    }
+    x_ = x;
+    return true;
+}
+
+const std::vector<double>& LinearPlant::get_state() const {
+    return x_;
+}
+
+bool LinearPlant::flatten(const Matrix& M, std::size_t rows, std::size_t cols, std::vector<double>& out) {
+    if (M.size() != rows)
+        return false;
+    out.clear();
+    out.reserve(rows * cols);
+    for (auto& row : M) {
+        if (row.size() != cols)
+            return false;
+        out.insert(out.end(), row.begin(), row.end());
+    }
+    return true;
+}
+
+}  // namespace mel
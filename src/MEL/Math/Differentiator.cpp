@@ -21,14 +21,14 @@ double Differentiator::update(double x, const Time& t) {
     switch (technique_) {
         case BackwardDifference:
             if (step_count_ > 0) {
-                derivative_ = (x - last_x_) / (t.as_seconds() - last_t_.as_seconds());
+                derivative_ = (x - last_x_) / (t - last_t_).as_seconds();
             }
         case CentralDifference:
             if (step_count_ > 1) {
-                derivative_ = (x - last_last_x_) / (t.as_seconds() - last_last_t_.as_seconds());
+                derivative_ = (x - last_last_x_) / (t - last_last_t_).as_seconds();
             } 
             else if (step_count_ > 0) {
-                derivative_ = (x - last_x_) / (t.as_seconds() - last_t_.as_seconds());
+                derivative_ = (x - last_x_) / (t - last_t_).as_seconds();
             }
     }
     last_last_x_ = last_x_;
@@ -0,0 +1,284 @@
+#include <MEL/Math/Trajectory.hpp>
+#include <MEL/Math/Constants.hpp>
+#include <MEL/Logging/Log.hpp>
+#include <algorithm>
+#include <cmath>
+
+namespace mel {
+
+//==============================================================================
+// CLASS DEFINITIONS
+//==============================================================================
+
+Trajectory::Trajectory(std::size_t dof, std::size_t capacity) :
+    dof_(dof),
+    capacity_(capacity < 2 ? 2 : capacity),
+    durations_(capacity_, 0.0),
+    pieces_(capacity_ * dof),
+    head_(0),
+    tail_(0),
+    end_q_(dof, 0.0),
+    end_v_(dof, 0.0),
+    end_a_(dof, 0.0),
+    active_(false),
+    segment_start_(0.0),
+    q_(dof, 0.0),
+    qd_(dof, 0.0),
+    qdd_(dof, 0.0)
+{
+}
+
+std::size_t Trajectory::size() const {
+    return dof_;
+}
+
+void Trajectory::reset(const std::vector<double>& position) {
+    if (position.size() != dof_) {
+        LOG(Error) << "Trajectory expected " << dof_ << " joint positions";
+        return;
+    }
+    head_ = 0;
+    tail_ = 0;
+    active_ = false;
+    end_q_ = position;
+    q_ = position;
+    std::fill(end_v_.begin(), end_v_.end(), 0.0);
+    std::fill(end_a_.begin(), end_a_.end(), 0.0);
+    std::fill(qd_.begin(), qd_.end(), 0.0);
+    std::fill(qdd_.begin(), qdd_.end(), 0.0);
+}
+
+bool Trajectory::add_minimum_jerk(const std::vector<double>& goal, Time duration) {
+    if (goal.size() != dof_) {
+        LOG(Error) << "Trajectory expected " << dof_ << " goal positions";
+        return false;
+    }
+    double T = duration.as_seconds();
+    if (T <= 0.0) {
+        LOG(Error) << "Trajectory segment duration must be positive";
+        return false;
+    }
+    std::size_t slot;
+    if (!reserve(1, slot))
+        return false;
+    durations_[slot % capacity_] = T;
+    Piece* pieces = &pieces_[(slot % capacity_) * dof_];
+    for (std::size_t j = 0; j < dof_; ++j) {
+        quintic(pieces[j], end_q_[j], end_v_[j], end_a_[j], goal[j], 0.0, 0.0, T);
+        end_q_[j] = goal[j];
+        end_v_[j] = 0.0;
+        end_a_[j] = 0.0;
+    }
+    publish(1);
+    return true;
+}
+
+bool Trajectory::add_trapezoidal(const std::vector<double>& goal,
+                                 const std::vector<double>& max_velocity,
+                                 const std::vector<double>& max_acceleration)
+{
+    if (goal.size() != dof_ || max_velocity.size() != dof_ || max_acceleration.size() != dof_) {
+        LOG(Error) << "Trajectory expected " << dof_ << " goal positions, velocities and accelerations";
+        return false;
+    }
+    for (std::size_t j = 0; j < dof_; ++j) {
+        if (max_velocity[j] <= 0.0 || max_acceleration[j] <= 0.0) {
+            LOG(Error) << "Trajectory velocity and acceleration limits must be positive";
+            return false;
+        }
+        if (end_v_[j] != 0.0 || end_a_[j] != 0.0) {
+            LOG(Error) << "Trajectory trapezoidal moves must start at rest";
+            return false;
+        }
+    }
+    // the slowest joint sets the duration
+    double T = 0.0;
+    for (std::size_t j = 0; j < dof_; ++j) {
+        double d = std::abs(goal[j] - end_q_[j]);
+        double v = max_velocity[j], a = max_acceleration[j];
+        double Tj = d >= v * v / a ? d / v + v / a : 2.0 * std::sqrt(d / a);
+        T = std::max(T, Tj);
+    }
+    if (T <= 0.0)
+        return true;
+    std::size_t slot;
+    if (!reserve(1, slot))
+        return false;
+    durations_[slot % capacity_] = T;
+    Piece* pieces = &pieces_[(slot % capacity_) * dof_];
+    for (std::size_t j = 0; j < dof_; ++j) {
+        // accelerate at the joint's limit for ta so it arrives exactly at T
+        double q0 = end_q_[j];
+        double d = goal[j] - q0;
+        double sgn = d < 0.0 ? -1.0 : 1.0;
+        double a = max_acceleration[j];
+        double ta = 0.5 * (T - std::sqrt(std::max(0.0, T * T - 4.0 * std::abs(d) / a)));
+        double v = a * ta;
+        Piece& p = pieces[j];
+        std::fill(&p.c[0][0], &p.c[0][0] + 18, 0.0);
+        p.start[0] = 0.0;
+        p.start[1] = ta;
+        p.start[2] = T - ta;
+        p.c[0][0] = q0;
+        p.c[0][2] = 0.5 * sgn * a;
+        p.c[1][0] = q0 + 0.5 * sgn * a * ta * ta;
+        p.c[1][1] = sgn * v;
+        p.c[2][0] = q0 + sgn * (0.5 * a * ta * ta + v * (T - 2.0 * ta));
+        p.c[2][1] = sgn * v;
+        p.c[2][2] = -0.5 * sgn * a;
+        end_q_[j] = goal[j];
+    }
+    publish(1);
+    return true;
+}
+
+bool Trajectory::add_spline(const std::vector<std::vector<double>>& waypoints,
+                            const std::vector<Time>& times)
+{
+    std::size_t n = waypoints.size();
+    if (n == 0 || times.size() != n) {
+        LOG(Error) << "Trajectory expected one time per waypoint";
+        return false;
+    }
+    std::vector<double> t(n + 1, 0.0);
+    for (std::size_t k = 0; k < n; ++k) {
+        if (waypoints[k].size() != dof_) {
+            LOG(Error) << "Trajectory expected " << dof_ << " positions per waypoint";
+            return false;
+        }
+        t[k + 1] = times[k].as_seconds();
+        if (t[k + 1] <= t[k]) {
+            LOG(Error) << "Trajectory waypoint times must be positive and increasing";
+            return false;
+        }
+    }
+    std::size_t slot;
+    if (!reserve(n, slot))
+        return false;
+    for (std::size_t j = 0; j < dof_; ++j) {
+        double q0 = end_q_[j], v0 = end_v_[j], a0 = end_a_[j];
+        for (std::size_t k = 0; k < n; ++k) {
+            double h = t[k + 1] - t[k];
+            double q1 = waypoints[k][j];
+            // interior knots take the mean of the neighbouring secant slopes,
+            // or stop at local extrema; the final knot is at rest
+            double v1 = 0.0;
+            if (k + 1 < n) {
+                double m0 = (q1 - q0) / h;
+                double m1 = (waypoints[k + 1][j] - q1) / (t[k + 2] - t[k + 1]);
+                v1 = m0 * m1 > 0.0 ? 0.5 * (m0 + m1) : 0.0;
+            }
+            std::size_t s = (slot + k) % capacity_;
+            durations_[s] = h;
+            quintic(pieces_[s * dof_ + j], q0, v0, a0, q1, v1, 0.0, h);
+            q0 = q1;
+            v0 = v1;
+            a0 = 0.0;
+        }
+        end_q_[j] = q0;
+        end_v_[j] = 0.0;
+        end_a_[j] = 0.0;
+    }
+    publish(n);
+    return true;
+}
+
+const std::vector<double>& Trajectory::get_planned_end() const {
+    return end_q_;
+}
+
+const std::vector<double>& Trajectory::update(Time t) {
+    double now = t.as_seconds();
+    std::size_t tail = tail_.load(std::memory_order_relaxed);
+    std::size_t head = head_.load(std::memory_order_acquire);
+    if (!active_) {
+        if (tail == head)
+            return q_;
+        active_ = true;
+        segment_start_ = now;
+    }
+    double tau = now - segment_start_;
+    while (tau >= durations_[tail % capacity_]) {
+        if (tail + 1 == head)
+            head = head_.load(std::memory_order_acquire);
+        if (tail + 1 == head) {
+            // out of segments: finish this one and hold its end at rest
+            evaluate(tail, durations_[tail % capacity_]);
+            std::fill(qd_.begin(), qd_.end(), 0.0);
+            std::fill(qdd_.begin(), qdd_.end(), 0.0);
+            tail_.store(tail + 1, std::memory_order_release);
+            active_ = false;
+            return q_;
+        }
+        tau -= durations_[tail % capacity_];
+        segment_start_ += durations_[tail % capacity_];
+        ++tail;
+    }
+    tail_.store(tail, std::memory_order_release);
+    evaluate(tail, tau);
+    return q_;
+}
+
+const std::vector<double>& Trajectory::get_positions() const {
+    return q_;
+}
+
+const std::vector<double>& Trajectory::get_velocities() const {
+    return qd_;
+}
+
+const std::vector<double>& Trajectory::get_accelerations() const {
+    return qdd_;
+}
+
+bool Trajectory::is_done() const {
+    return !active_ && tail_.load(std::memory_order_relaxed) == head_.load(std::memory_order_acquire);
+}
+
+void Trajectory::quintic(Piece& p, double q0, double v0, double a0,
+                         double q1, double v1, double a1, double T)
+{
+    double h = q1 - q0;
+    double T2 = T * T, T3 = T2 * T;
+    std::fill(&p.c[0][0], &p.c[0][0] + 18, 0.0);
+    p.start[0] = 0.0;
+    p.start[1] = INF;
+    p.start[2] = INF;
+    p.c[0][0] = q0;
+    p.c[0][1] = v0;
+    p.c[0][2] = 0.5 * a0;
+    p.c[0][3] = (20.0 * h - (8.0 * v1 + 12.0 * v0) * T - (3.0 * a0 - a1) * T2) / (2.0 * T3);
+    p.c[0][4] = (-30.0 * h + (14.0 * v1 + 16.0 * v0) * T + (3.0 * a0 - 2.0 * a1) * T2) / (2.0 * T3 * T);
+    p.c[0][5] = (12.0 * h - 6.0 * (v1 + v0) * T + (a1 - a0) * T2) / (2.0 * T3 * T2);
+}
+
+bool Trajectory::reserve(std::size_t count, std::size_t& slot) const {
+    std::size_t head = head_.load(std::memory_order_relaxed);
+    std::size_t tail = tail_.load(std::memory_order_acquire);
+    if (head + count - tail > capacity_) {
+        LOG(Warning) << "Trajectory cannot queue " << count << " segments, "
+                     << capacity_ - (head - tail) << " slots free";
+        return false;
+    }
+    slot = head;
+    return true;
+}
+
+void Trajectory::publish(std::size_t count) {
+    head_.store(head_.load(std::memory_order_relaxed) + count, std::memory_order_release);
+}
+
+void Trajectory::evaluate(std::size_t slot, double tau) {
+    const Piece* pieces = &pieces_[(slot % capacity_) * dof_];
+    for (std::size_t j = 0; j < dof_; ++j) {
+        const Piece& p = pieces[j];
+        int k = (tau >= p.start[1]) + (tau >= p.start[2]);
+        double s = tau - p.start[k];
+        const double* c = p.c[k];
+        q_[j]   = c[0] + s * (c[1] + s * (c[2] + s * (c[3] + s * (c[4] + s * c[5]))));
+        qd_[j]  = c[1] + s * (2.0 * c[2] + s * (3.0 * c[3] + s * (4.0 * c[4] + s * 5.0 * c[5])));
+        qdd_[j] = 2.0 * c[2] + s * (6.0 * c[3] + s * (12.0 * c[4] + s * 20.0 * c[5]));
+    }
+}
+
+} // namespace mel
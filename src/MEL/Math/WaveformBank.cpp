@@ -0,0 +1,122 @@
+#include <MEL/Math/WaveformBank.hpp>
+#include <MEL/Math/Constants.hpp>
+#include <cmath>
+
+namespace mel {
+
+//==============================================================================
+// CLASS DEFINITIONS
+//==============================================================================
+
+WaveformBank::WaveformBank(std::size_t size, uint32 seed) {
+    resize(size);
+    this->seed(seed);
+}
+
+void WaveformBank::resize(std::size_t size) {
+    frequency_.resize(size, 0.0);
+    phase_.resize(size, 0.0);
+    sin_.resize(size, 0.0);
+    square_.resize(size, 0.0);
+    triangle_.resize(size, 0.0);
+    sawtooth_.resize(size, 0.0);
+    offset_.resize(size, 0.0);
+    noise_.resize(size, 0.0);
+    state_.resize(size, 1);
+}
+
+std::size_t WaveformBank::size() const {
+    return frequency_.size();
+}
+
+void WaveformBank::set_waveform(std::size_t i, const Waveform& waveform, double phase) {
+    frequency_[i] = 1.0 / waveform.period.as_seconds();
+    phase_[i]     = phase;
+    sin_[i]       = 0.0;
+    square_[i]    = 0.0;
+    triangle_[i]  = 0.0;
+    sawtooth_[i]  = 0.0;
+    offset_[i]    = waveform.offset;
+    switch (waveform.type) {
+        case Waveform::Sin:
+            sin_[i] = waveform.amplitude;
+            break;
+        case Waveform::Cos:
+            sin_[i] = waveform.amplitude;
+            phase_[i] += 0.25;
+            break;
+        case Waveform::Square:
+            square_[i] = waveform.amplitude;
+            break;
+        case Waveform::Triangle:
+            triangle_[i] = waveform.amplitude;
+            break;
+        case Waveform::Sawtooth:
+            sawtooth_[i] = waveform.amplitude;
+            break;
+    }
+}
+
+void WaveformBank::set_noise(std::size_t i, double amplitude) {
+    noise_[i] = amplitude;
+}
+
+void WaveformBank::seed(uint32 seed) {
+    for (std::size_t i = 0; i < state_.size(); ++i) {
+        // splitmix-style scramble so neighboring channels are uncorrelated
+        uint32 s = seed + static_cast<uint32>(i) * 0x9E3779B9u;
+        s = (s ^ (s >> 16)) * 0x85EBCA6Bu;
+        s = (s ^ (s >> 13)) * 0xC2B2AE35u;
+        s ^= s >> 16;
+        state_[i] = s ? s : 1; // xorshift state must be nonzero
+    }
+}
+
+void WaveformBank::evaluate(Time t, double* values) {
+    const std::size_t n = frequency_.size();
+    const double s = t.as_seconds();
+    const double* frequency = frequency_.data();
+    const double* phase     = phase_.data();
+    const double* sine      = sin_.data();
+    const double* square    = square_.data();
+    const double* triangle  = triangle_.data();
+    const double* sawtooth  = sawtooth_.data();
+    const double* offset    = offset_.data();
+    const double* noise     = noise_.data();
+    uint32* state           = state_.data();
+    for (std::size_t i = 0; i < n; ++i) {
+        // position within the current cycle in [0,1)
+        double x = frequency[i] * s + phase[i];
+        x -= std::floor(x);
+        // sine: fold to [-1/4, 1/4] cycle and evaluate odd Taylor series (error < 1e-9)
+        double z = x >= 0.5 ? x - 1.0 : x;
+        double a = z < 0.0 ? -z : z;
+        a = a > 0.25 ? 0.5 - a : a;
+        double w  = 2.0 * PI * (z < 0.0 ? -a : a);
+        double w2 = w * w;
+        double sn = w * (1.0 + w2 * (-1.0 / 6.0 + w2 * (1.0 / 120.0 + w2 * (-1.0 / 5040.0 +
+                    w2 * (1.0 / 362880.0 + w2 * (-1.0 / 39916800.0 + w2 * (1.0 / 6227020800.0)))))));
+        // square, triangle and sawtooth from x directly
+        double sq = x < 0.5 ? 1.0 : -1.0;
+        double y  = x + 0.25;
+        y = y >= 1.0 ? y - 1.0 : y;
+        double tr = 1.0 - 4.0 * (y < 0.5 ? 0.5 - y : y - 0.5);
+        double sw = 2.0 * x - 1.0;
+        // uniform noise in [-1, 1]
+        uint32 r = state[i];
+        r ^= r << 13;
+        r ^= r >> 17;
+        r ^= r << 5;
+        state[i] = r;
+        double u = static_cast<double>(r) * (2.0 / 4294967296.0) - 1.0;
+        values[i] = sine[i] * sn + square[i] * sq + triangle[i] * tr + sawtooth[i] * sw + offset[i] + noise[i] * u;
+    }
+}
+
+void WaveformBank::operator()(Time t, std::vector<double>& values) {
+    if (values.size() != frequency_.size())
+        values.resize(frequency_.size());
+    evaluate(t, values.data());
+}
+
+}  // namespace mel
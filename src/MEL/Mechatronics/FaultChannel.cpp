@@ -0,0 +1,220 @@
+#include <MEL/Mechatronics/FaultChannel.hpp>
+#include <MEL/Core/Timer.hpp>
+#include <MEL/Logging/Log.hpp>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+
+namespace mel {
+
+namespace {
+
+const char* kind_name(FaultEvent::Kind kind) {
+    switch (kind) {
+        case FaultEvent::PositionMin: return "min position limit";
+        case FaultEvent::PositionMax: return "max position limit";
+        case FaultEvent::Velocity:    return "velocity limit";
+        case FaultEvent::Torque:      return "torque limit";
+        case FaultEvent::Limit:       return "limit";
+    }
+    return "limit";
+}
+
+void stop_default_logging() {
+    FaultChannel::get_default().stop_logging();
+}
+
+} // namespace
+
+//==============================================================================
+// FAULT CHANNEL
+//==============================================================================
+
+FaultChannel::FaultChannel(std::size_t capacity) :
+    mask_(0),
+    enqueue_pos_(0),
+    dequeue_pos_(0),
+    dropped_(0),
+    dropped_logged_(0),
+    thread_(0, std::vector<int>(), false),
+    logging_(false),
+    start_on_push_(false)
+{
+    std::size_t size = 2;
+    while (size < capacity)
+        size <<= 1;
+    cells_.reset(new Cell[size]);
+    for (std::size_t i = 0; i < size; ++i)
+        cells_[i].sequence.store(i, std::memory_order_relaxed);
+    mask_ = size - 1;
+}
+
+FaultChannel::~FaultChannel() {
+    stop_logging();
+}
+
+bool FaultChannel::push(const FaultEvent& event) {
+    if (start_on_push_.load(std::memory_order_relaxed) && start_on_push_.exchange(false)) {
+        // the logger was constructed before this first event, so stopping from
+        // an atexit handler registered now runs before the logger is destroyed
+        if (start_logging())
+            std::atexit(stop_default_logging);
+    }
+    std::size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+    for (;;) {
+        Cell& cell = cells_[pos & mask_];
+        std::size_t seq = cell.sequence.load(std::memory_order_acquire);
+        std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos);
+        if (diff == 0) {
+            if (enqueue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                cell.event = event;
+                cell.sequence.store(pos + 1, std::memory_order_release);
+                return true;
+            }
+        }
+        else if (diff < 0) {
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        else {
+            pos = enqueue_pos_.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+bool FaultChannel::pop(FaultEvent& event) {
+    Cell& cell = cells_[dequeue_pos_ & mask_];
+    std::size_t seq = cell.sequence.load(std::memory_order_acquire);
+    if (seq != dequeue_pos_ + 1)
+        return false;
+    event = cell.event;
+    cell.sequence.store(dequeue_pos_ + mask_ + 1, std::memory_order_release);
+    ++dequeue_pos_;
+    return true;
+}
+
+std::size_t FaultChannel::log(std::size_t max_events) {
+    std::size_t logged = 0;
+    FaultEvent event;
+    while (logged < max_events && pop(event)) {
+        if (event.active)
+            LOG(Warning) << event.source << " exceeded the " << kind_name(event.kind) << " "
+                         << event.limit << " with a value of " << event.value << " at " << event.time;
+        else
+            LOG(Info) << event.source << " returned within the " << kind_name(event.kind) << " "
+                      << event.limit << " at " << event.time << " after " << event.count
+                      << " violating checks with a peak value of " << event.value;
+        ++logged;
+    }
+    uint64 dropped = dropped_.load(std::memory_order_relaxed);
+    if (dropped != dropped_logged_) {
+        LOG(Warning) << "FaultChannel dropped " << dropped - dropped_logged_ << " events because it was full";
+        dropped_logged_ = dropped;
+    }
+    return logged;
+}
+
+bool FaultChannel::start_logging(Time period, std::size_t max_events) {
+    if (logging_) {
+        LOG(Warning) << "FaultChannel already logging";
+        return false;
+    }
+    if (period <= Time::Zero) {
+        LOG(Error) << "FaultChannel logging period must be positive";
+        return false;
+    }
+    logging_ = true;
+    if (!thread_.start([this, period, max_events]() {
+            Timer timer(period, Timer::Sleep);
+            while (logging_) {
+                log(max_events);
+                timer.wait();
+            }
+        })) {
+        logging_ = false;
+        return false;
+    }
+    return true;
+}
+
+void FaultChannel::stop_logging() {
+    if (!logging_)
+        return;
+    logging_ = false;
+    thread_.join();
+    log(mask_ + 1);
+}
+
+Time FaultChannel::get_time() const {
+    return clock_.get_elapsed_time();
+}
+
+uint64 FaultChannel::get_dropped() const {
+    return dropped_;
+}
+
+FaultChannel& FaultChannel::get_default() {
+    static FaultChannel channel;
+    static bool armed = (channel.start_on_push_ = true);
+    (void)armed;
+    return channel;
+}
+
+//==============================================================================
+// FAULT LATCH
+//==============================================================================
+
+FaultLatch::FaultLatch() :
+    active_(false),
+    count_(0),
+    peak_(0.0),
+    limit_(0.0)
+{
+}
+
+void FaultLatch::update(FaultChannel* channel,
+                        const std::string& source,
+                        FaultEvent::Kind kind,
+                        bool violated,
+                        double value,
+                        double limit)
+{
+    if (violated) {
+        if (active_) {
+            ++count_;
+            if (std::abs(value) > std::abs(peak_))
+                peak_ = value;
+            return;
+        }
+        active_ = true;
+        count_ = 1;
+        peak_ = value;
+        limit_ = limit;
+    }
+    else if (active_) {
+        active_ = false;
+        value = peak_;
+        limit = limit_;
+    }
+    else {
+        return;
+    }
+    if (!channel)
+        return;
+    FaultEvent event;
+    std::strncpy(event.source, source.c_str(), sizeof(event.source) - 1);
+    event.source[sizeof(event.source) - 1] = '\0';
+    event.kind = kind;
+    event.active = active_;
+    event.value = value;
+    event.limit = limit;
+    event.time = channel->get_time();
+    event.count = count_;
+    channel->push(event);
+}
+
+bool FaultLatch::is_active() const {
+    return active_;
+}
+
+} // namespace mel
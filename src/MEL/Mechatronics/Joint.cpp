@@ -33,7 +33,8 @@ namespace mel {
     velocity_limit_(velocity_limit),
     has_torque_limit_(true),
     has_position_limits_(true),
-    has_velocity_limit_(true)
+    has_velocity_limit_(true),
+    fault_channel_(&FaultChannel::get_default())
 { }
 
  Joint::Joint(const std::string& name,
@@ -61,7 +62,8 @@ namespace mel {
      velocity_limit_(velocity_limit),
      has_torque_limit_(true),
      has_position_limits_(true),
-     has_velocity_limit_(true)
+     has_velocity_limit_(true),
+     fault_channel_(&FaultChannel::get_default())
  { }
 
 bool Joint::on_enable() {
@@ -76,6 +78,10 @@ bool Joint::on_disable() {
     return false;
 }
 
+void Joint::set_fault_channel(FaultChannel* channel) {
+    fault_channel_ = channel;
+}
+
 double Joint::get_position() {
     position_ = position_sensor_transmission_ * position_sensor_->get_position();
     return position_;
@@ -96,10 +102,10 @@ double Joint::get_torque_sense() {
 
 void Joint::set_torque(double new_torque) {
     torque_ = new_torque;
-    if (torque_limit_exceeded() && saturate_) {
-        LOG(Warning) << "Joint " << get_name() << " command torque saturated to " << torque_limit_;
+    bool exceeded = torque_limit_exceeded();
+    torque_fault_.update(fault_channel_, get_name(), FaultEvent::Torque, exceeded, torque_, torque_limit_);
+    if (exceeded && saturate_)
         torque_ = saturate(torque_, torque_limit_);
-    }
     actuator_->set_torque(actuator_transmission_ * torque_);
 }
 
@@ -109,35 +115,22 @@ void Joint::add_torque(double additional_torque) {
 }
 
 bool Joint::torque_limit_exceeded() {
-    bool exceeded = false;
-    if (has_torque_limit_ && abs(torque_) > torque_limit_) {
-        LOG(Warning) << "Joint " << get_name() << " command torque exceeded the torque limit " << torque_limit_ << " with a value of " << torque_;
-        exceeded = true;
-    }
-    return exceeded;
+    return has_torque_limit_ && abs(torque_) > torque_limit_;
 }
 
 bool Joint::position_limit_exceeded() {
     get_position();
-    bool exceeded = false;
-    if (has_position_limits_ && position_ < position_limits_[0]) {
-        LOG(Warning) << "Joint " << get_name() << " position exceeded the min position limit " << position_limits_[0] << " with a value of " << position_;
-        exceeded = true;
-    }
-    if (has_position_limits_ && position_ > position_limits_[1]) {
-        LOG(Warning) << "Joint " << get_name() << " position exceeded the max position limit " << position_limits_[1] << " with a value of " << position_;
-        exceeded = true;
-    }
-    return exceeded;
+    bool below = has_position_limits_ && position_ < position_limits_[0];
+    bool above = has_position_limits_ && position_ > position_limits_[1];
+    position_min_fault_.update(fault_channel_, get_name(), FaultEvent::PositionMin, below, position_, position_limits_[0]);
+    position_max_fault_.update(fault_channel_, get_name(), FaultEvent::PositionMax, above, position_, position_limits_[1]);
+    return below || above;
 }
 
 bool Joint::velocity_limit_exceeded() {
     get_velocity();
-    bool exceeded = false;
-    if (has_velocity_limit_ && abs(velocity_) > velocity_limit_) {
-        LOG(Warning) << "Joint " << get_name() << " velocity exceeded the velocity limit " << velocity_limit_ << " with a value of " << velocity_;
-        exceeded = true;
-    }
+    bool exceeded = has_velocity_limit_ && abs(velocity_) > velocity_limit_;
+    velocity_fault_.update(fault_channel_, get_name(), FaultEvent::Velocity, exceeded, velocity_, velocity_limit_);
     return exceeded;
 }
 
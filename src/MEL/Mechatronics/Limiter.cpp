@@ -6,7 +6,9 @@
 namespace mel {
 
 Limiter::Limiter() :
-    mode_(None)
+    mode_(None),
+    exceeded_(false),
+    fault_channel_(nullptr)
 {
 }
 
@@ -14,7 +16,8 @@ Limiter::Limiter(double abs_limit) :
     mode_(Saturate),
     min_limit_(-abs(abs_limit)),
     max_limit_(abs(abs_limit)),
-    exceeded_(false)
+    exceeded_(false),
+    fault_channel_(nullptr)
 {
 }
 
@@ -22,7 +25,8 @@ Limiter::Limiter(double min_limit, double max_limit) :
     mode_(Saturate),
     min_limit_(min_limit),
     max_limit_(max_limit),
-    exceeded_(false)
+    exceeded_(false),
+    fault_channel_(nullptr)
 {
 }
 
@@ -35,7 +39,8 @@ Limiter::Limiter(double continuous_limit, double abs_limit, Time time_limit) :
     accumulator_(0.0),
     limited_value_(0.0),
     clock_(Clock()),
-    exceeded_(false)
+    exceeded_(false),
+    fault_channel_(nullptr)
 {
 }
 
@@ -60,6 +65,8 @@ double Limiter::limit(double unlimited_value) {
         exceeded_ = true;
     else
         exceeded_ = false;
+    if (fault_channel_)
+        fault_latch_.update(fault_channel_, fault_source_, FaultEvent::Limit, exceeded_, unlimited_value, limited_value_);
     return limited_value_;
 }
 
@@ -86,5 +93,10 @@ void Limiter::reset() {
     }
 }
 
+void Limiter::set_fault_channel(FaultChannel* channel, const std::string& source) {
+    fault_channel_ = channel;
+    fault_source_ = source;
+}
+
 
 };
@@ -0,0 +1,157 @@
+#include <MEL/Mechatronics/PidBank.hpp>
+#include <MEL/Math/Constants.hpp>
+#include <MEL/Logging/Log.hpp>
+#include <algorithm>
+
+namespace mel {
+
+namespace {
+
+// Updates all axes in one pass. The arrays never overlap, and __restrict
+// tells the compiler so; otherwise the number of pairwise overlap checks
+// exceeds what it is willing to emit and the loop stays scalar.
+template <bool UseXdot>
+void pid_kernel(std::size_t n,
+                const double* __restrict x_ref,
+                const double* __restrict x,
+                const double* __restrict xdot,
+                const double* __restrict kp,
+                const double* __restrict ki,
+                const double* __restrict kd,
+                const double* __restrict integral_max,
+                const double* __restrict effort_max,
+                double* __restrict error,
+                double* __restrict integral,
+                double* __restrict derivative,
+                double* __restrict effort,
+                double half_dt,
+                double inv_dt,
+                double alpha)
+{
+    for (std::size_t k = 0; k < n; ++k) {
+        double e  = x_ref[k] - x[k];
+        double ed = UseXdot ? -xdot[k] : (e - error[k]) * inv_dt;
+        ed = derivative[k] + alpha * (ed - derivative[k]);
+        double ui = integral[k] + ki[k] * half_dt * (e + error[k]);
+        ui = ui > integral_max[k] ? integral_max[k] : ui;
+        ui = ui < -integral_max[k] ? -integral_max[k] : ui;
+        double u = kp[k] * e + ui + kd[k] * ed;
+        u = u > effort_max[k] ? effort_max[k] : u;
+        u = u < -effort_max[k] ? -effort_max[k] : u;
+        error[k]      = e;
+        integral[k]   = ui;
+        derivative[k] = ed;
+        effort[k]     = u;
+    }
+}
+
+} // namespace
+
+//==============================================================================
+// CLASS DEFINITIONS
+//==============================================================================
+
+PidBank::PidBank(std::size_t axes, double _kp, double _ki, double _kd) :
+    kp(axes, _kp),
+    ki(axes, _ki),
+    kd(axes, _kd),
+    axes_(axes),
+    integral_max_(axes, INF),
+    effort_max_(axes, INF),
+    error_(axes, 0.0),
+    integral_(axes, 0.0),
+    derivative_(axes, 0.0),
+    effort_(axes, 0.0),
+    tau_(0.0),
+    last_t_(Time::Zero),
+    started_(false)
+{
+}
+
+std::size_t PidBank::size() const {
+    return axes_;
+}
+
+void PidBank::set_gains(std::size_t axis, double _kp, double _ki, double _kd) {
+    kp[axis] = _kp;
+    ki[axis] = _ki;
+    kd[axis] = _kd;
+}
+
+void PidBank::set_integral_limit(std::size_t axis, double limit) {
+    integral_max_[axis] = limit;
+}
+
+void PidBank::set_effort_limit(std::size_t axis, double limit) {
+    effort_max_[axis] = limit;
+}
+
+void PidBank::set_derivative_cutoff(Frequency cutoff) {
+    tau_ = cutoff.as_hertz() > 0 ? cutoff.to_time().as_seconds() / (2.0 * PI) : 0.0;
+}
+
+const std::vector<double>& PidBank::calculate(const std::vector<double>& x_ref,
+                                              const std::vector<double>& x,
+                                              Time t)
+{
+    if (x_ref.size() != axes_ || x.size() != axes_) {
+        LOG(Error) << "PidBank expected " << axes_ << " references and states";
+        return effort_;
+    }
+    double half_dt, inv_dt, alpha;
+    step(t, half_dt, inv_dt, alpha);
+    pid_kernel<false>(axes_, x_ref.data(), x.data(), nullptr, kp.data(), ki.data(), kd.data(),
+                      integral_max_.data(), effort_max_.data(), error_.data(), integral_.data(),
+                      derivative_.data(), effort_.data(), half_dt, inv_dt, alpha);
+    return effort_;
+}
+
+const std::vector<double>& PidBank::calculate(const std::vector<double>& x_ref,
+                                              const std::vector<double>& x,
+                                              const std::vector<double>& xdot,
+                                              Time t)
+{
+    if (x_ref.size() != axes_ || x.size() != axes_ || xdot.size() != axes_) {
+        LOG(Error) << "PidBank expected " << axes_ << " references, states and state derivatives";
+        return effort_;
+    }
+    double half_dt, inv_dt, alpha;
+    step(t, half_dt, inv_dt, alpha);
+    pid_kernel<true>(axes_, x_ref.data(), x.data(), xdot.data(), kp.data(), ki.data(), kd.data(),
+                     integral_max_.data(), effort_max_.data(), error_.data(), integral_.data(),
+                     derivative_.data(), effort_.data(), half_dt, inv_dt, alpha);
+    return effort_;
+}
+
+const std::vector<double>& PidBank::get_efforts() const {
+    return effort_;
+}
+
+void PidBank::reset() {
+    std::fill(error_.begin(), error_.end(), 0.0);
+    std::fill(integral_.begin(), integral_.end(), 0.0);
+    std::fill(derivative_.begin(), derivative_.end(), 0.0);
+    std::fill(effort_.begin(), effort_.end(), 0.0);
+    last_t_ = Time::Zero;
+    started_ = false;
+}
+
+void PidBank::step(Time t, double& half_dt, double& inv_dt, double& alpha) {
+    double dt = started_ ? (t - last_t_).as_seconds() : 0.0;
+    last_t_ = t;
+    started_ = true;
+    if (dt > 0.0) {
+        half_dt = 0.5 * dt;
+        inv_dt = 1.0 / dt;
+        alpha = dt / (tau_ + dt);
+    }
+    else {
+        // first tick (or a repeated timestamp): hold the integral and
+        // derivative and only latch the error
+        half_dt = 0.0;
+        inv_dt = 0.0;
+        alpha = 0.0;
+    }
+}
+
+} // namespace mel
@@ -1,5 +1,6 @@
 #include <MEL/Mechatronics/Robot.hpp>
 #include <MEL/Core/Console.hpp>
+#include <MEL/Logging/Log.hpp>
 
 namespace mel {
 
@@ -27,6 +28,9 @@ bool Robot::on_disable() {
 
 void Robot::add_joint(const Joint& joint) {
     joints_.push_back(joint);
+    joint_positions_.resize(joints_.size(), 0.0);
+    joint_velocities_.resize(joints_.size(), 0.0);
+    joint_torques_.resize(joints_.size(), 0.0);
 }
 
 Joint& Robot::get_joint(uint32 joint_number) {
@@ -37,26 +41,86 @@ Joint& Robot::operator[](uint32 joint_number) {
     return get_joint(joint_number);
 }
 
-std::vector<double> Robot::get_joint_positions() {
-    std::vector<double> joint_positions;
-    joint_positions.reserve(joints_.size());
-    for (auto it = joints_.begin(); it != joints_.end(); ++it)
-        joint_positions.push_back(it->get_position());
-    return joint_positions_ = joint_positions;
+void Robot::update() {
+    for (std::size_t i = 0; i < joints_.size(); ++i) {
+        Joint& joint = joints_[i];
+        joint.position_ = joint.position_sensor_transmission_ * joint.position_sensor_->get_position();
+        joint.velocity_ = joint.velocity_sensor_transmission_ * joint.velocity_sensor_->get_velocity();
+        joint_positions_[i] = joint.position_;
+        joint_velocities_[i] = joint.velocity_;
+    }
 }
 
-std::vector<double> Robot::get_joint_velocities() {
-    std::vector<double> joint_velocities;
-    joint_velocities.reserve(joints_.size());
+const std::vector<double>& Robot::get_joint_positions() {
+    for (std::size_t i = 0; i < joints_.size(); ++i) {
+        Joint& joint = joints_[i];
+        joint.position_ = joint.position_sensor_transmission_ * joint.position_sensor_->get_position();
+        joint_positions_[i] = joint.position_;
+    }
+    return joint_positions_;
+}
+
+const std::vector<double>& Robot::get_joint_velocities() {
+    for (std::size_t i = 0; i < joints_.size(); ++i) {
+        Joint& joint = joints_[i];
+        joint.velocity_ = joint.velocity_sensor_transmission_ * joint.velocity_sensor_->get_velocity();
+        joint_velocities_[i] = joint.velocity_;
+    }
+    return joint_velocities_;
+}
+
+const std::vector<double>& Robot::get_last_joint_positions() const {
+    return joint_positions_;
+}
+
+const std::vector<double>& Robot::get_last_joint_velocities() const {
+    return joint_velocities_;
+}
+
+const std::vector<double>& Robot::get_joint_torques() const {
+    return joint_torques_;
+}
+
+void Robot::set_joint_torques(const std::vector<double>& new_torques) {
+    if (new_torques.size() != joints_.size()) {
+        LOG(Error) << "Robot " << get_name() << " expected " << joints_.size()
+                   << " joint torques but got " << new_torques.size();
+        return;
+    }
+    for (std::size_t i = 0; i < joints_.size(); ++i) {
+        joints_[i].set_torque(new_torques[i]);
+        joint_torques_[i] = joints_[i].torque_;
+    }
+}
+
+void Robot::set_fault_channel(FaultChannel* channel) {
     for (auto it = joints_.begin(); it != joints_.end(); ++it)
-        joint_velocities.push_back(it->get_velocity());
-    return joint_velocities_ = joint_velocities;
+        it->set_fault_channel(channel);
 }
 
-void Robot::set_joint_torques(std::vector<double> new_torques) {
-    for (auto it = joints_.begin(); it != joints_.end(); ++it) {
-        it->set_torque(new_torques[it - joints_.begin()]);
+bool Robot::load_model(const std::string& filepath) {
+    RobotModel model;
+    if (!model.load(filepath))
+        return false;
+    if (model.size() != joints_.size()) {
+        LOG(Error) << "Robot " << get_name() << " has " << joints_.size()
+                   << " joints but model " << filepath << " has " << model.size() << " links";
+        return false;
     }
+    model_ = model;
+    return true;
+}
+
+RobotModel& Robot::get_model() {
+    return model_;
+}
+
+const std::vector<double>& Robot::get_gravity_torques() {
+    return model_.gravity_torques(joint_positions_);
+}
+
+const std::vector<double>& Robot::get_inverse_dynamics(const std::vector<double>& qdd) {
+    return model_.inverse_dynamics(joint_positions_, joint_velocities_, qdd);
 }
 
 bool Robot::any_position_limit_exceeded() {
@@ -0,0 +1,301 @@
+#include <MEL/Mechatronics/RobotModel.hpp>
+#include <MEL/Logging/Log.hpp>
+#include <cmath>
+#include <fstream>
+#include <sstream>
+
+namespace mel {
+
+namespace {
+
+// c = a x b
+inline void cross(const double* a, const double* b, double* c) {
+    c[0] = a[1] * b[2] - a[2] * b[1];
+    c[1] = a[2] * b[0] - a[0] * b[2];
+    c[2] = a[0] * b[1] - a[1] * b[0];
+}
+
+// y = R x
+inline void rotate(const double* R, const double* x, double* y) {
+    y[0] = R[0] * x[0] + R[1] * x[1] + R[2] * x[2];
+    y[1] = R[3] * x[0] + R[4] * x[1] + R[5] * x[2];
+    y[2] = R[6] * x[0] + R[7] * x[1] + R[8] * x[2];
+}
+
+// y = R^T x
+inline void rotate_t(const double* R, const double* x, double* y) {
+    y[0] = R[0] * x[0] + R[3] * x[1] + R[6] * x[2];
+    y[1] = R[1] * x[0] + R[4] * x[1] + R[7] * x[2];
+    y[2] = R[2] * x[0] + R[5] * x[1] + R[8] * x[2];
+}
+
+// y = I x for a symmetric tensor stored as Ixx, Iyy, Izz, Ixy, Ixz, Iyz
+inline void inertia_times(const std::array<double, 6>& I, const double* x, double* y) {
+    y[0] = I[0] * x[0] + I[3] * x[1] + I[4] * x[2];
+    y[1] = I[3] * x[0] + I[1] * x[1] + I[5] * x[2];
+    y[2] = I[4] * x[0] + I[5] * x[1] + I[2] * x[2];
+}
+
+} // namespace
+
+//==============================================================================
+// CLASS DEFINITIONS
+//==============================================================================
+
+RobotModel::RobotModel() :
+    gravity_({ { 0.0, 0.0, -9.81 } }),
+    tool_({ { 0.0, 0.0, 0.0 } })
+{
+}
+
+void RobotModel::add_link(const Link& link) {
+    links_.push_back(link);
+    states_.resize(links_.size());
+    zeros_.assign(links_.size(), 0.0);
+    tau_.assign(links_.size(), 0.0);
+    jacobian_.assign(6 * links_.size(), 0.0);
+}
+
+bool RobotModel::load(const std::string& filepath) {
+    std::ifstream file(filepath);
+    if (!file.is_open()) {
+        LOG(Error) << "Failed to open RobotModel file " << filepath;
+        return false;
+    }
+    std::vector<Link> links;
+    std::string line;
+    std::size_t line_number = 0;
+    while (std::getline(file, line)) {
+        ++line_number;
+        std::size_t first = line.find_first_not_of(" \t\r");
+        if (first == std::string::npos || line[first] == '#')
+            continue;
+        std::istringstream line_stream(line);
+        std::string value;
+        double values[15];
+        std::size_t count = 0;
+        while (count < 15 && std::getline(line_stream, value, ',')) {
+            std::istringstream value_stream(value);
+            if (!(value_stream >> values[count])) {
+                LOG(Error) << "Invalid value '" << value << "' on line " << line_number << " of RobotModel file " << filepath;
+                return false;
+            }
+            ++count;
+        }
+        if (count != 15) {
+            LOG(Error) << "Expected 15 values on line " << line_number << " of RobotModel file " << filepath;
+            return false;
+        }
+        Link link;
+        link.type = values[0] != 0.0 ? Prismatic : Revolute;
+        link.a = values[1];
+        link.alpha = values[2];
+        link.d = values[3];
+        link.theta = values[4];
+        link.mass = values[5];
+        link.com = { { values[6], values[7], values[8] } };
+        link.inertia = { { values[9], values[10], values[11], values[12], values[13], values[14] } };
+        links.push_back(link);
+    }
+    links_.clear();
+    for (auto& link : links)
+        add_link(link);
+    return true;
+}
+
+std::size_t RobotModel::size() const {
+    return links_.size();
+}
+
+const RobotModel::Link& RobotModel::get_link(std::size_t i) const {
+    return links_[i];
+}
+
+void RobotModel::set_gravity(const std::array<double, 3>& gravity) {
+    gravity_ = gravity;
+}
+
+void RobotModel::set_tool(const std::array<double, 3>& tool) {
+    tool_ = tool;
+}
+
+bool RobotModel::forward_kinematics(const std::vector<double>& q) {
+    if (!check_size(q, "positions"))
+        return false;
+    transforms(q.data());
+    return true;
+}
+
+std::array<double, 3> RobotModel::get_frame_position(std::size_t i) const {
+    const double* p = states_[i].p0;
+    return { { p[0], p[1], p[2] } };
+}
+
+std::array<double, 9> RobotModel::get_frame_rotation(std::size_t i) const {
+    const double* R = states_[i].R0;
+    return { { R[0], R[1], R[2], R[3], R[4], R[5], R[6], R[7], R[8] } };
+}
+
+std::array<double, 3> RobotModel::get_tool_position() const {
+    std::array<double, 3> tool = { { 0.0, 0.0, 0.0 } };
+    if (states_.empty())
+        return tool;
+    const State& last = states_.back();
+    rotate(last.R0, tool_.data(), tool.data());
+    for (int k = 0; k < 3; ++k)
+        tool[k] += last.p0[k];
+    return tool;
+}
+
+const std::vector<double>& RobotModel::jacobian(const std::vector<double>& q) {
+    if (!check_size(q, "positions"))
+        return jacobian_;
+    transforms(q.data());
+    std::array<double, 3> tool = get_tool_position();
+    for (std::size_t i = 0; i < links_.size(); ++i) {
+        const State& s = states_[i];
+        double z[3] = { s.R0[2], s.R0[5], s.R0[8] };
+        double* col = &jacobian_[6 * i];
+        if (links_[i].type == Revolute) {
+            double r[3] = { tool[0] - s.p0[0], tool[1] - s.p0[1], tool[2] - s.p0[2] };
+            cross(z, r, col);
+            col[3] = z[0];
+            col[4] = z[1];
+            col[5] = z[2];
+        }
+        else {
+            col[0] = z[0];
+            col[1] = z[1];
+            col[2] = z[2];
+            col[3] = col[4] = col[5] = 0.0;
+        }
+    }
+    return jacobian_;
+}
+
+const std::vector<double>& RobotModel::inverse_dynamics(const std::vector<double>& q,
+                                                        const std::vector<double>& qd,
+                                                        const std::vector<double>& qdd)
+{
+    if (!check_size(q, "positions") || !check_size(qd, "velocities") || !check_size(qdd, "accelerations"))
+        return tau_;
+    transforms(q.data());
+    const std::size_t n = links_.size();
+    // outward pass: velocities, accelerations, and the net force/moment on
+    // each link (stored in f and n until the inward pass)
+    double w_prev[3] = { 0.0, 0.0, 0.0 };
+    double wd_prev[3] = { 0.0, 0.0, 0.0 };
+    double vd_prev[3] = { -gravity_[0], -gravity_[1], -gravity_[2] };
+    for (std::size_t i = 0; i < n; ++i) {
+        const Link& L = links_[i];
+        State& s = states_[i];
+        double t[3], u[3], a[3];
+        // acceleration of this origin in the previous frame
+        cross(wd_prev, s.p, t);
+        cross(w_prev, s.p, u);
+        cross(w_prev, u, a);
+        for (int k = 0; k < 3; ++k)
+            t[k] += a[k] + vd_prev[k];
+        rotate_t(s.R, t, s.vd);
+        rotate_t(s.R, w_prev, s.w);
+        rotate_t(s.R, wd_prev, s.wd);
+        if (L.type == Revolute) {
+            // wd += w_prev x qd z, expressed in this frame, then qdd z
+            s.wd[0] += s.w[1] * qd[i];
+            s.wd[1] -= s.w[0] * qd[i];
+            s.wd[2] += qdd[i];
+            s.w[2] += qd[i];
+        }
+        else {
+            s.vd[0] += 2.0 * s.w[1] * qd[i];
+            s.vd[1] -= 2.0 * s.w[0] * qd[i];
+            s.vd[2] += qdd[i];
+        }
+        // acceleration of the center of mass
+        const double* c = L.com.data();
+        double vc[3];
+        cross(s.wd, c, vc);
+        cross(s.w, c, u);
+        cross(s.w, u, a);
+        for (int k = 0; k < 3; ++k)
+            s.f[k] = L.mass * (vc[k] + a[k] + s.vd[k]);
+        inertia_times(L.inertia, s.wd, s.n);
+        inertia_times(L.inertia, s.w, u);
+        cross(s.w, u, a);
+        for (int k = 0; k < 3; ++k)
+            s.n[k] += a[k];
+        for (int k = 0; k < 3; ++k) {
+            w_prev[k] = s.w[k];
+            wd_prev[k] = s.wd[k];
+            vd_prev[k] = s.vd[k];
+        }
+    }
+    // inward pass: accumulate child forces and moments into joint torques
+    for (std::size_t i = n; i-- > 0;) {
+        const Link& L = links_[i];
+        State& s = states_[i];
+        double m[3];
+        cross(L.com.data(), s.f, m);
+        for (int k = 0; k < 3; ++k)
+            s.n[k] += m[k];
+        if (i + 1 < n) {
+            const State& child = states_[i + 1];
+            double fc[3], nc[3];
+            rotate(child.R, child.f, fc);
+            rotate(child.R, child.n, nc);
+            cross(child.p, fc, m);
+            for (int k = 0; k < 3; ++k) {
+                s.f[k] += fc[k];
+                s.n[k] += nc[k] + m[k];
+            }
+        }
+        tau_[i] = L.type == Revolute ? s.n[2] : s.f[2];
+    }
+    return tau_;
+}
+
+const std::vector<double>& RobotModel::gravity_torques(const std::vector<double>& q) {
+    return inverse_dynamics(q, zeros_, zeros_);
+}
+
+void RobotModel::transforms(const double* q) {
+    for (std::size_t i = 0; i < links_.size(); ++i) {
+        const Link& L = links_[i];
+        State& s = states_[i];
+        double theta = L.theta + (L.type == Revolute ? q[i] : 0.0);
+        double d = L.d + (L.type == Prismatic ? q[i] : 0.0);
+        double ct = std::cos(theta), st = std::sin(theta);
+        double ca = std::cos(L.alpha), sa = std::sin(L.alpha);
+        s.R[0] = ct;      s.R[1] = -st;     s.R[2] = 0.0;
+        s.R[3] = st * ca; s.R[4] = ct * ca; s.R[5] = -sa;
+        s.R[6] = st * sa; s.R[7] = ct * sa; s.R[8] = ca;
+        s.p[0] = L.a;
+        s.p[1] = -sa * d;
+        s.p[2] = ca * d;
+        if (i == 0) {
+            for (int k = 0; k < 9; ++k)
+                s.R0[k] = s.R[k];
+            for (int k = 0; k < 3; ++k)
+                s.p0[k] = s.p[k];
+        }
+        else {
+            const State& parent = states_[i - 1];
+            for (int r = 0; r < 3; ++r)
+                for (int c = 0; c < 3; ++c)
+                    s.R0[3 * r + c] = parent.R0[3 * r] * s.R[c] + parent.R0[3 * r + 1] * s.R[3 + c] + parent.R0[3 * r + 2] * s.R[6 + c];
+            rotate(parent.R0, s.p, s.p0);
+            for (int k = 0; k < 3; ++k)
+                s.p0[k] += parent.p0[k];
+        }
+    }
+}
+
+bool RobotModel::check_size(const std::vector<double>& v, const char* name) const {
+    if (v.size() != links_.size()) {
+        LOG(Error) << "RobotModel expected " << links_.size() << " joint " << name << " but got " << v.size();
+        return false;
+    }
+    return true;
+}
+
+} // namespace mel
@@ -0,0 +1,171 @@
+#include <MEL/Utility/RealtimeThread.hpp>
+#include <MEL/Logging/Log.hpp>
+#include <cerrno>
+#include <cstring>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#include <sched.h>
+#include <sys/mman.h>
+#include <sys/resource.h>
+#endif
+
+namespace mel {
+
+//==============================================================================
+// HELPER FUNCTIONS
+//==============================================================================
+
+namespace {
+
+/// Touches bytes of stack below the current frame so the pages are mapped
+/// (and locked, if mlockall is active) before the real-time work starts
+void prefault_stack(std::size_t bytes) {
+    volatile unsigned char chunk[4096];
+    for (std::size_t i = 0; i < sizeof(chunk); i += 64)
+        chunk[i] = 0;
+    if (bytes > sizeof(chunk))
+        prefault_stack(bytes - sizeof(chunk));
+    chunk[0] = chunk[sizeof(chunk) - 64];  // prevent tail call optimization
+}
+
+#if defined(__linux__)
+void read_usage(RealtimeThread::Stats& stats) {
+    rusage usage;
+    std::memset(&usage, 0, sizeof(usage));
+    getrusage(RUSAGE_THREAD, &usage);
+    stats.minor_faults         = usage.ru_minflt;
+    stats.major_faults         = usage.ru_majflt;
+    stats.voluntary_switches   = usage.ru_nvcsw;
+    stats.involuntary_switches = usage.ru_nivcsw;
+}
+#else
+void read_usage(RealtimeThread::Stats& stats) {
+    stats.minor_faults         = 0;
+    stats.major_faults         = 0;
+    stats.voluntary_switches   = 0;
+    stats.involuntary_switches = 0;
+}
+#endif
+
+}  // namespace
+
+//==============================================================================
+// CLASS DEFINITIONS
+//==============================================================================
+
+RealtimeThread::RealtimeThread(int priority,
+                               const std::vector<int>& cpus,
+                               bool lock_memory,
+                               std::size_t stack_prefault) :
+    priority_(priority),
+    cpus_(cpus),
+    lock_memory_(lock_memory),
+    stack_prefault_(stack_prefault),
+    running_(false)
+{
+    std::memset(&stats_, 0, sizeof(stats_));
+}
+
+RealtimeThread::~RealtimeThread() {
+    join();
+}
+
+bool RealtimeThread::start(std::function<void()> func) {
+    if (thread_.joinable()) {
+        LOG(Warning) << "RealtimeThread already started";
+        return false;
+    }
+    running_ = true;
+    thread_ = std::thread(&RealtimeThread::run, this, func);
+    return true;
+}
+
+void RealtimeThread::join() {
+    if (thread_.joinable())
+        thread_.join();
+}
+
+bool RealtimeThread::is_running() const {
+    return running_;
+}
+
+const RealtimeThread::Stats& RealtimeThread::get_stats() const {
+    return stats_;
+}
+
+void RealtimeThread::run(std::function<void()> func) {
+    configure();
+    if (stack_prefault_ > 0)
+        prefault_stack(stack_prefault_);
+    Stats before;
+    read_usage(before);
+    func();
+    read_usage(stats_);
+    stats_.minor_faults         -= before.minor_faults;
+    stats_.major_faults         -= before.major_faults;
+    stats_.voluntary_switches   -= before.voluntary_switches;
+    stats_.involuntary_switches -= before.involuntary_switches;
+    running_ = false;
+}
+
+#ifdef _WIN32
+
+void RealtimeThread::configure() {
+    HANDLE handle = GetCurrentThread();
+    if (priority_ > 0) {
+        stats_.realtime = SetThreadPriority(handle, THREAD_PRIORITY_TIME_CRITICAL) != 0;
+        if (!stats_.realtime)
+            LOG(Warning) << "RealtimeThread failed to set priority. Code: " << static_cast<int>(GetLastError());
+    }
+    if (!cpus_.empty()) {
+        DWORD_PTR mask = 0;
+        for (auto& cpu : cpus_)
+            mask |= static_cast<DWORD_PTR>(1) << cpu;
+        stats_.affinity = SetThreadAffinityMask(handle, mask) != 0;
+        if (!stats_.affinity)
+            LOG(Warning) << "RealtimeThread failed to set CPU affinity. Code: " << static_cast<int>(GetLastError());
+    }
+    if (lock_memory_)
+        LOG(Warning) << "RealtimeThread memory locking is not supported on Windows";
+}
+
+#else
+
+void RealtimeThread::configure() {
+    pthread_t this_thread = pthread_self();
+    if (priority_ > 0) {
+        sched_param params;
+        params.sched_priority = priority_;
+        int ret = pthread_setschedparam(this_thread, SCHED_FIFO, &params);
+        stats_.realtime = ret == 0;
+        if (!stats_.realtime)
+            LOG(Warning) << "RealtimeThread failed to set SCHED_FIFO priority " << priority_ << ": " << std::strerror(ret);
+    }
+#if defined(__linux__)
+    if (!cpus_.empty()) {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        for (auto& cpu : cpus_)
+            CPU_SET(cpu, &set);
+        int ret = pthread_setaffinity_np(this_thread, sizeof(set), &set);
+        stats_.affinity = ret == 0;
+        if (!stats_.affinity)
+            LOG(Warning) << "RealtimeThread failed to set CPU affinity: " << std::strerror(ret);
+    }
+#else
+    if (!cpus_.empty())
+        LOG(Warning) << "RealtimeThread CPU affinity is not supported on this platform";
+#endif
+    if (lock_memory_) {
+        stats_.memory_locked = mlockall(MCL_CURRENT | MCL_FUTURE) == 0;
+        if (!stats_.memory_locked)
+            LOG(Warning) << "RealtimeThread failed to lock memory: " << std::strerror(errno);
+    }
+}
+
+#endif
+
+}  // namespace mel
@@ -183,18 +183,18 @@ void sleep(Time duration) {
             // ::Sleep(duration.as_milliseconds()); // low-resolution method
             HANDLE timer;
             LARGE_INTEGER ft;
-            ft.QuadPart = -(10 * duration.as_microseconds());
+            ft.QuadPart = -(duration.as_nanoseconds() / 100);
             timer = CreateWaitableTimer(NULL, TRUE, NULL);
             SetWaitableTimer(timer, &ft, 0, NULL, NULL, 0);
             WaitForSingleObject(timer, INFINITE);
             CloseHandle(timer);
             // timeEndPeriod(tc.wPeriodMin); // to much overhead, not necessary?
         #else
-            uint64 usecs = duration.as_microseconds();
+            uint64 nsecs = duration.as_nanoseconds();
             // Construct the time to wait
             timespec ti;
-            ti.tv_nsec = (usecs % 1000000) * 1000;
-            ti.tv_sec = usecs / 1000000;
+            ti.tv_nsec = nsecs % 1000000000;
+            ti.tv_sec = nsecs / 1000000000;
             // If nanosleep returns -1, we check errno. If it is EINTR
             // nanosleep was interrupted and has set ti to the remaining
             // duration. We continue sleeping until the complete duration